@@ -128,6 +128,17 @@ private:
     uint64_t MispredCount{0};
   };
 
+  /// Traces aggregated from a subset of LBR samples. Branch events are
+  /// aggregated by several threads, each into its own LBRAggregation, and the
+  /// results are merged into BranchLBRs and FallthroughLBRs.
+  struct LBRAggregation {
+    std::unordered_map<Trace, TakenBranchInfo, TraceHash> BranchLBRs;
+    std::unordered_map<Trace, FTInfo, TraceHash> FallthroughLBRs;
+    uint64_t NumTraces{0};
+    uint64_t NumInvalidTraces{0};
+    uint64_t NumLongRangeTraces{0};
+  };
+
   /// Intermediate storage for profile data. We save the results of parsing
   /// and use them later for processing and assigning profile.
   std::unordered_map<Trace, TakenBranchInfo, TraceHash> BranchLBRs;
@@ -321,8 +332,9 @@ private:
   /// Parse a single LBR entry as output by perf script -Fbrstack
   ErrorOr<LBREntry> parseLBREntry();
 
-  /// Parse LBR sample, returns the number of traces.
-  uint64_t parseLBRSample(const PerfBranchSample &Sample, bool NeedsSkylakeFix);
+  /// Aggregate the traces of an LBR sample into \p Aggr.
+  void parseLBRSample(const PerfBranchSample &Sample, bool NeedsSkylakeFix,
+                      LBRAggregation &Aggr) const;
 
   /// Parse and pre-aggregate branch events.
   std::error_code parseBranchEvents();
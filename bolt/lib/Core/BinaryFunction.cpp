@@ -1503,8 +1503,13 @@ bool BinaryFunction::scanExternalRefs() {
   assert(FunctionData.size() == getMaxSize() &&
          "function size does not match raw data size");
 
-  BC.SymbolicDisAsm->setSymbolizer(
-      BC.MIB->createTargetSymbolizer(*this, /*CreateSymbols*/ false));
+  // Without relocations we only look for branch targets, and those are never
+  // symbolized. Skip the symbolizer and use the plain disassembler instead.
+  MCDisassembler &DisAsm =
+      BC.HasRelocations ? *BC.SymbolicDisAsm : *BC.DisAsm;
+  if (BC.HasRelocations)
+    BC.SymbolicDisAsm->setSymbolizer(
+        BC.MIB->createTargetSymbolizer(*this, /*CreateSymbols*/ false));
 
   // Disassemble contents of the function. Detect code entry points and create
   // relocations for references to code that will be moved.
@@ -1518,9 +1523,8 @@ bool BinaryFunction::scanExternalRefs() {
 
     const uint64_t AbsoluteInstrAddr = getAddress() + Offset;
     MCInst Instruction;
-    if (!BC.SymbolicDisAsm->getInstruction(Instruction, Size,
-                                           FunctionData.slice(Offset),
-                                           AbsoluteInstrAddr, nulls())) {
+    if (!DisAsm.getInstruction(Instruction, Size, FunctionData.slice(Offset),
+                               AbsoluteInstrAddr, nulls())) {
       if (opts::Verbosity >= 1 && !isZeroPaddingAt(Offset)) {
         BC.errs()
             << "BOLT-WARNING: unable to disassemble instruction at offset 0x"
@@ -1630,7 +1634,8 @@ bool BinaryFunction::scanExternalRefs() {
   }
 
   // Reset symbolizer for the disassembler.
-  BC.SymbolicDisAsm->setSymbolizer(nullptr);
+  if (BC.HasRelocations)
+    BC.SymbolicDisAsm->setSymbolizer(nullptr);
 
   // Add relocations unless disassembly failed for this function.
   if (!DisassemblyFailed)
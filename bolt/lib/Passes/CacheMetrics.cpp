@@ -14,7 +14,9 @@
 #include "bolt/Passes/CacheMetrics.h"
 #include "bolt/Core/BinaryBasicBlock.h"
 #include "bolt/Core/BinaryFunction.h"
+#include "bolt/Core/JumpTable.h"
 #include <unordered_map>
+#include <unordered_set>
 
 using namespace llvm;
 using namespace bolt;
@@ -28,6 +30,10 @@ namespace {
 constexpr unsigned ITLBPageSize = 4096;
 constexpr unsigned ITLBEntries = 16;
 
+/// Size of a huge page used for reporting the TLB footprint of hot code and
+/// data.
+constexpr uint64_t HugePageSize = 2 << 20;
+
 /// Initialize and return a position map for binary basic blocks
 void extractBasicBlockInfo(
     const std::vector<BinaryFunction *> &BinaryFunctions,
@@ -210,6 +216,86 @@ double expectedCacheHitRatio(
   return 100.0 * (1.0 - Misses / TotalSamples);
 }
 
+/// The set of regular and huge pages touched by a collection of address ranges.
+struct PageFootprint {
+  std::unordered_set<uint64_t> Pages;
+  std::unordered_set<uint64_t> HugePages;
+
+  void add(uint64_t Address, uint64_t Size) {
+    if (!Size)
+      return;
+    const uint64_t EndAddress = Address + Size - 1;
+    for (uint64_t Page = Address / ITLBPageSize;
+         Page <= EndAddress / ITLBPageSize; ++Page)
+      Pages.insert(Page);
+    for (uint64_t Page = Address / HugePageSize;
+         Page <= EndAddress / HugePageSize; ++Page)
+      HugePages.insert(Page);
+  }
+};
+
+/// Report the number of pages touched by executed basic blocks (i-TLB) and by
+/// the jump tables they read (d-TLB), in the input and in the output binary.
+/// Jump tables that were moved to a shared section have no known output
+/// offset; they are excluded from the output footprint and counted separately.
+void printTLBFootprint(raw_ostream &OS,
+                       const std::vector<BinaryFunction *> &BinaryFunctions) {
+  PageFootprint CodeBefore, CodeAfter, DataBefore, DataAfter;
+  std::unordered_set<const JumpTable *> HotJumpTables;
+  size_t NumUnknownJumpTables = 0;
+
+  for (BinaryFunction *BF : BinaryFunctions) {
+    if (!BF->hasProfile())
+      continue;
+    const BinaryContext &BC = BF->getBinaryContext();
+    for (BinaryBasicBlock &BB : *BF) {
+      if (BB.getKnownExecutionCount() == 0)
+        continue;
+      const bool HasInputRange =
+          BB.getInputOffset() != BinaryBasicBlock::INVALID_OFFSET &&
+          BB.getEndOffset() != BinaryBasicBlock::INVALID_OFFSET;
+      if (HasInputRange)
+        CodeBefore.add(BF->getAddress() + BB.getInputOffset(),
+                       BB.getOriginalSize());
+      if (BF->isSimple() || BC.HasRelocations)
+        CodeAfter.add(BB.getOutputAddressRange().first, BB.getOutputSize());
+      else if (HasInputRange)
+        CodeAfter.add(BF->getAddress() + BB.getInputOffset(),
+                      BB.getOriginalSize());
+
+      for (MCInst &Inst : BB) {
+        const JumpTable *JT = BF->getJumpTable(Inst);
+        if (!JT || !HotJumpTables.insert(JT).second)
+          continue;
+        DataBefore.add(JT->getAddress(), JT->getSize());
+        if (!JT->isMoved())
+          DataAfter.add(JT->getAddress(), JT->getSize());
+        else if (JT->getOutputSection().getOutputAddress() &&
+                 JT->getOutputSection().isAnonymous())
+          DataAfter.add(JT->getOutputAddress(), JT->getSize());
+        else
+          ++NumUnknownJumpTables;
+      }
+    }
+  }
+
+  OS << format("  Executed code touches %zu 4KB pages (%zu 2MB pages) in the "
+               "input and %zu 4KB pages (%zu 2MB pages) in the output\n",
+               CodeBefore.Pages.size(), CodeBefore.HugePages.size(),
+               CodeAfter.Pages.size(), CodeAfter.HugePages.size());
+  if (HotJumpTables.empty())
+    return;
+  OS << format("  %zu jump tables used by executed code touch %zu 4KB pages "
+               "(%zu 2MB pages) in the input and %zu 4KB pages (%zu 2MB pages) "
+               "in the output",
+               HotJumpTables.size(), DataBefore.Pages.size(),
+               DataBefore.HugePages.size(), DataAfter.Pages.size(),
+               DataAfter.HugePages.size());
+  if (NumUnknownJumpTables)
+    OS << format(" (excluding %zu relocated tables)", NumUnknownJumpTables);
+  OS << '\n';
+}
+
 } // namespace
 
 void CacheMetrics::printAll(raw_ostream &OS,
@@ -259,11 +345,13 @@ void CacheMetrics::printAll(raw_ostream &OS,
   size_t HotCodeSize = HotCodeMaxAddr - HotCodeMinAddr;
   size_t TotalCodeSize = TotalCodeMaxAddr - TotalCodeMinAddr;
 
-  size_t HugePage2MB = 2 << 20;
   OS << format("  Hot code takes %.2lf%% of binary (%zu bytes out of %zu, "
                "%.2lf huge pages)\n",
                100.0 * HotCodeSize / TotalCodeSize, HotCodeSize, TotalCodeSize,
-               double(HotCodeSize) / HugePage2MB);
+               double(HotCodeSize) / HugePageSize);
+
+  // Stats related to the TLB footprint of executed code and data
+  printTLBFootprint(OS, BFs);
 
   // Stats related to expected cache performance
   std::unordered_map<BinaryBasicBlock *, uint64_t> BBAddr;
@@ -14,6 +14,7 @@
 #include "bolt/Profile/DataAggregator.h"
 #include "bolt/Core/BinaryContext.h"
 #include "bolt/Core/BinaryFunction.h"
+#include "bolt/Core/ParallelUtilities.h"
 #include "bolt/Passes/BinaryPasses.h"
 #include "bolt/Profile/BoltAddressTranslation.h"
 #include "bolt/Profile/Heatmap.h"
@@ -1403,9 +1404,9 @@ std::error_code DataAggregator::printLBRHeatMap() {
   return std::error_code();
 }
 
-uint64_t DataAggregator::parseLBRSample(const PerfBranchSample &Sample,
-                                        bool NeedsSkylakeFix) {
-  uint64_t NumTraces{0};
+void DataAggregator::parseLBRSample(const PerfBranchSample &Sample,
+                                    bool NeedsSkylakeFix,
+                                    LBRAggregation &Aggr) const {
   // LBRs are stored in reverse execution order. NextPC refers to the next
   // recorded executed PC.
   uint64_t NextPC = opts::UseEventPC ? Sample.PC : 0;
@@ -1427,7 +1428,7 @@ uint64_t DataAggregator::parseLBRSample(const PerfBranchSample &Sample,
       const BinaryFunction *TraceBF =
           getBinaryFunctionContainingAddress(TraceFrom);
       if (TraceBF && TraceBF->containsAddress(TraceTo)) {
-        FTInfo &Info = FallthroughLBRs[Trace(TraceFrom, TraceTo)];
+        FTInfo &Info = Aggr.FallthroughLBRs[Trace(TraceFrom, TraceTo)];
         if (TraceBF->containsAddress(LBR.From))
           ++Info.InternCount;
         else
@@ -1441,7 +1442,7 @@ uint64_t DataAggregator::parseLBRSample(const PerfBranchSample &Sample,
                    << formatv(" @ {0:x}", TraceFrom - TraceBF->getAddress())
                    << formatv(" and ending @ {0:x}\n", TraceTo);
           });
-          ++NumInvalidTraces;
+          ++Aggr.NumInvalidTraces;
         } else {
           LLVM_DEBUG({
             dbgs() << "Out of range trace starting in "
@@ -1453,10 +1454,10 @@ uint64_t DataAggregator::parseLBRSample(const PerfBranchSample &Sample,
                    << formatv(" @ {0:x}\n",
                               TraceTo - (ToFunc ? ToFunc->getAddress() : 0));
           });
-          ++NumLongRangeTraces;
+          ++Aggr.NumLongRangeTraces;
         }
       }
-      ++NumTraces;
+      ++Aggr.NumTraces;
     }
     NextPC = LBR.From;
 
@@ -1464,11 +1465,10 @@ uint64_t DataAggregator::parseLBRSample(const PerfBranchSample &Sample,
     uint64_t To = getBinaryFunctionContainingAddress(LBR.To) ? LBR.To : 0;
     if (!From && !To)
       continue;
-    TakenBranchInfo &Info = BranchLBRs[Trace(From, To)];
+    TakenBranchInfo &Info = Aggr.BranchLBRs[Trace(From, To)];
     ++Info.TakenCount;
     Info.MispredCount += LBR.Mispred;
   }
-  return NumTraces;
 }
 
 std::error_code DataAggregator::parseBranchEvents() {
@@ -1483,6 +1483,47 @@ std::error_code DataAggregator::parseBranchEvents() {
   uint64_t NumTraces = 0;
   bool NeedsSkylakeFix = false;
 
+  // Samples are parsed on this thread in batches. Attributing their LBR
+  // entries to functions is the expensive part, so each full batch is split
+  // among the thread pool while the next one is being parsed. Every task
+  // aggregates into its own LBRAggregation, and these are merged at the end.
+  // Only two batches are alive at a time, which bounds memory regardless of
+  // the profile size.
+  constexpr size_t BatchSize = 16384;
+  ThreadPoolInterface *Pool =
+      opts::NoThreads ? nullptr : &ParallelUtilities::getThreadPool();
+  const unsigned NumTasks =
+      Pool ? std::max(1U, opts::ThreadCount.getValue()) : 1;
+  std::vector<LBRAggregation> Aggregations(NumTasks);
+  std::vector<PerfBranchSample> Batch;
+  std::vector<PerfBranchSample> InFlight;
+  Batch.reserve(BatchSize);
+  auto WaitForTasks = make_scope_exit([&] {
+    if (Pool)
+      Pool->wait();
+  });
+  auto aggregateBatch = [&](bool SkylakeFix) {
+    if (Pool)
+      Pool->wait();
+    std::swap(Batch, InFlight);
+    Batch.clear();
+    const size_t SamplesPerTask = divideCeil(InFlight.size(), NumTasks);
+    for (unsigned I = 0; I < NumTasks; ++I) {
+      auto Work = [&, I, SkylakeFix] {
+        ArrayRef<PerfBranchSample> Samples =
+            ArrayRef(InFlight)
+                .drop_front(std::min(InFlight.size(), I * SamplesPerTask))
+                .take_front(SamplesPerTask);
+        for (const PerfBranchSample &Sample : Samples)
+          parseLBRSample(Sample, SkylakeFix, Aggregations[I]);
+      };
+      if (Pool)
+        Pool->async(Work);
+      else
+        Work();
+    }
+  };
+
   while (hasData() && NumTotalSamples < opts::MaxSamples) {
     ++NumTotalSamples;
 
@@ -1506,10 +1547,36 @@ std::error_code DataAggregator::parseBranchEvents() {
     NumEntries += Sample.LBR.size();
     if (BAT && Sample.LBR.size() == 32 && !NeedsSkylakeFix) {
       errs() << "PERF2BOLT-WARNING: using Intel Skylake bug workaround\n";
+      // The workaround applies from this sample on, so aggregate the samples
+      // seen so far without it.
+      aggregateBatch(NeedsSkylakeFix);
       NeedsSkylakeFix = true;
     }
 
-    NumTraces += parseLBRSample(Sample, NeedsSkylakeFix);
+    Batch.push_back(std::move(Sample));
+    if (Batch.size() == BatchSize)
+      aggregateBatch(NeedsSkylakeFix);
+  }
+  aggregateBatch(NeedsSkylakeFix);
+  if (Pool)
+    Pool->wait();
+
+  for (LBRAggregation &Aggr : Aggregations) {
+    NumTraces += Aggr.NumTraces;
+    NumInvalidTraces += Aggr.NumInvalidTraces;
+    NumLongRangeTraces += Aggr.NumLongRangeTraces;
+    for (const auto &[Trace, Info] : Aggr.FallthroughLBRs) {
+      FTInfo &Merged = FallthroughLBRs[Trace];
+      Merged.InternCount += Info.InternCount;
+      Merged.ExternCount += Info.ExternCount;
+    }
+    for (const auto &[Trace, Info] : Aggr.BranchLBRs) {
+      TakenBranchInfo &Merged = BranchLBRs[Trace];
+      Merged.TakenCount += Info.TakenCount;
+      Merged.MispredCount += Info.MispredCount;
+    }
+    clear(Aggr.FallthroughLBRs);
+    clear(Aggr.BranchLBRs);
   }
 
   for (const Trace &Trace : llvm::make_first_range(BranchLBRs))
@@ -9,6 +9,7 @@
 #include "bolt/Profile/YAMLProfileReader.h"
 #include "bolt/Core/BinaryBasicBlock.h"
 #include "bolt/Core/BinaryFunction.h"
+#include "bolt/Core/ParallelUtilities.h"
 #include "bolt/Passes/MCF.h"
 #include "bolt/Profile/ProfileYAMLMapping.h"
 #include "bolt/Utils/Utils.h"
@@ -28,6 +29,12 @@ static llvm::cl::opt<bool>
                cl::desc("ignore hash while reading function profile"),
                cl::Hidden, cl::cat(BoltOptCategory));
 
+static llvm::cl::opt<bool> MatchProfileWithFunctionHash(
+    "match-profile-with-function-hash",
+    cl::desc("match profiles that did not match by name to functions with the "
+             "same hash (for renamed or moved functions)"),
+    cl::Hidden, cl::cat(BoltOptCategory));
+
 llvm::cl::opt<bool> ProfileUseDFS("profile-use-dfs",
                                   cl::desc("use DFS order for YAML profile"),
                                   cl::Hidden, cl::cat(BoltOptCategory));
@@ -415,6 +422,9 @@ Error YAMLProfileReader::readProfile(BinaryContext &BC) {
     if (!YamlBF.Used && BF && !ProfiledFunctions.count(BF))
       matchProfileToFunction(YamlBF, *BF);
 
+  if (opts::MatchProfileWithFunctionHash && !opts::IgnoreHash)
+    matchWithFunctionHash(BC);
+
   for (yaml::bolt::BinaryFunctionProfile &YamlBF : YamlBP.Functions)
     if (!YamlBF.Used && opts::Verbosity >= 1)
       errs() << "BOLT-WARNING: profile ignored for function " << YamlBF.Name
@@ -442,6 +452,52 @@ Error YAMLProfileReader::readProfile(BinaryContext &BC) {
   return Error::success();
 }
 
+void YAMLProfileReader::matchWithFunctionHash(BinaryContext &BC) {
+  size_t NumUnmatched = 0;
+  for (const yaml::bolt::BinaryFunctionProfile &YamlBF : YamlBP.Functions)
+    if (!YamlBF.Used)
+      ++NumUnmatched;
+  if (!NumUnmatched)
+    return;
+
+  // Hash all functions that are still without a profile.
+  ParallelUtilities::runOnEachFunction(
+      BC, ParallelUtilities::SchedulingPolicy::SP_BB_LINEAR,
+      [&](BinaryFunction &BF) {
+        BF.computeHash(YamlBP.Header.IsDFSOrder, YamlBP.Header.HashFunction);
+      },
+      [&](const BinaryFunction &BF) {
+        return !BF.hasCFG() || ProfiledFunctions.count(&BF);
+      },
+      "computeHash");
+
+  // Functions with a hash shared by several candidates are ambiguous and are
+  // left unmatched.
+  std::unordered_map<uint64_t, BinaryFunction *> HashToFunction;
+  for (auto &[Address, BF] : BC.getBinaryFunctions()) {
+    if (!BF.hasCFG() || ProfiledFunctions.count(&BF) || !BF.getHash())
+      continue;
+    auto [It, Inserted] = HashToFunction.try_emplace(BF.getHash(), &BF);
+    if (!Inserted)
+      It->second = nullptr;
+  }
+
+  size_t NumMatched = 0;
+  for (yaml::bolt::BinaryFunctionProfile &YamlBF : YamlBP.Functions) {
+    if (YamlBF.Used)
+      continue;
+    auto It = HashToFunction.find(YamlBF.Hash);
+    if (It == HashToFunction.end() || !It->second ||
+        ProfiledFunctions.count(It->second))
+      continue;
+    matchProfileToFunction(YamlBF, *It->second);
+    ++NumMatched;
+  }
+
+  outs() << "BOLT-INFO: matched " << NumMatched << " out of " << NumUnmatched
+         << " unmatched profiles to functions by hash\n";
+}
+
 bool YAMLProfileReader::usesEvent(StringRef Name) const {
   return YamlBP.Header.EventNames.find(std::string(Name)) != StringRef::npos;
 }
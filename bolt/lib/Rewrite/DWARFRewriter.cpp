@@ -363,6 +363,13 @@ static cl::opt<unsigned> BatchSize(
         "better performance, but more memory usage. Default value is 1."),
     cl::Hidden, cl::init(1), cl::cat(BoltCategory));
 
+static cl::opt<unsigned> BatchMemoryLimit(
+    "cu-processing-batch-memory-limit",
+    cl::desc("Limits, in MB, the size of input .debug_info processed in a "
+             "single CU batch. A batch is closed early if adding the next CU "
+             "would exceed the limit. Default value is 0 (no limit)."),
+    cl::Hidden, cl::init(0), cl::cat(BoltCategory));
+
 static cl::opt<bool> AlwaysConvertToRanges(
     "always-convert-to-ranges",
     cl::desc("This option is for testing purposes only. It forces BOLT to "
@@ -561,11 +568,14 @@ emitDWOBuilder(const std::string &DWOName, DIEBuilder &DWODIEBuilder,
 using DWARFUnitVec = std::vector<DWARFUnit *>;
 using CUPartitionVector = std::vector<DWARFUnitVec>;
 /// Partitions CUs in to buckets. Bucket size is controlled by
-/// cu-processing-batch-size. All the CUs that have cross CU reference reference
-/// as a source are put in to the same initial bucket.
+/// cu-processing-batch-size and cu-processing-batch-memory-limit. All the CUs
+/// that have cross CU reference reference as a source are put in to the same
+/// initial bucket.
 static CUPartitionVector partitionCUs(DWARFContext &DwCtx) {
   CUPartitionVector Vec(2);
   unsigned Counter = 0;
+  const uint64_t BatchBytesLimit = uint64_t(opts::BatchMemoryLimit) << 20;
+  uint64_t BatchBytes = 0;
   const DWARFDebugAbbrev *Abbr = DwCtx.getDebugAbbrev();
   for (std::unique_ptr<DWARFUnit> &CU : DwCtx.compile_units()) {
     Expected<const DWARFAbbreviationDeclarationSet *> AbbrDeclSet =
@@ -589,11 +599,24 @@ static CUPartitionVector partitionCUs(DWARFContext &DwCtx) {
     if (CrossCURefFound) {
       Vec[0].push_back(CU.get());
     } else {
+      // DIE trees built for a batch are roughly proportional to the size of
+      // the input units, so bound the batch by the input size.
+      const uint64_t CUBytes = CU->getNextUnitOffset() - CU->getOffset();
+      if (BatchBytesLimit && !Vec.back().empty() &&
+          BatchBytes + CUBytes > BatchBytesLimit) {
+        Vec.push_back({});
+        Counter = 0;
+        BatchBytes = 0;
+      }
       ++Counter;
       Vec.back().push_back(CU.get());
+      BatchBytes += CUBytes;
     }
-    if (Counter % opts::BatchSize == 0 && !Vec.back().empty())
+    if (Counter % opts::BatchSize == 0 && !Vec.back().empty()) {
       Vec.push_back({});
+      Counter = 0;
+      BatchBytes = 0;
+    }
   }
   return Vec;
 }
@@ -58,6 +58,7 @@
 #include "llvm/Support/Timer.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
 #include <algorithm>
 #include <fstream>
 #include <memory>
@@ -104,6 +105,14 @@ cl::opt<std::string>
                     "output binary via bolt info section"),
            cl::cat(BoltCategory));
 
+static cl::opt<std::string> DisassemblyCacheFile(
+    "disassembly-cache",
+    cl::desc("file recording functions that could not be disassembled; "
+             "unchanged functions listed there are ignored without "
+             "disassembling them again, and the file is updated afterwards "
+             "(non-relocation mode only)"),
+    cl::value_desc("filename"), cl::Hidden, cl::cat(BoltCategory));
+
 cl::opt<bool> DumpDotAll(
     "dump-dot-all",
     cl::desc("dump function CFGs to graphviz format after each stage;"
@@ -3216,6 +3225,25 @@ void RewriteInstance::processProfileData() {
 void RewriteInstance::disassembleFunctions() {
   NamedRegionTimer T("disassembleFunctions", "disassemble functions",
                      TimerGroupName, TimerGroupDesc, opts::TimeRewrite);
+
+  // Functions that failed to disassemble in a previous run, keyed by address
+  // and mapped to a hash of their contents. A failing function is ignored, so
+  // if its bytes have not changed we can ignore it again right away. This is
+  // limited to non-relocation mode, where ignored functions, and anything
+  // their partial disassembly would have referenced, stay at their original
+  // addresses.
+  const bool UseDisassemblyCache =
+      !opts::DisassemblyCacheFile.empty() && !BC->HasRelocations &&
+      !opts::processAllFunctions();
+  std::unordered_map<uint64_t, uint64_t> CachedFailures;
+  std::vector<std::pair<uint64_t, uint64_t>> Failures;
+  if (UseDisassemblyCache) {
+    std::ifstream CacheFile(opts::DisassemblyCacheFile, std::ios::in);
+    uint64_t Address, Hash;
+    while (CacheFile >> std::hex >> Address >> Hash)
+      CachedFailures[Address] = Hash;
+  }
+
   for (auto &BFI : BC->getBinaryFunctions()) {
     BinaryFunction &Function = BFI.second;
 
@@ -3245,6 +3273,28 @@ void RewriteInstance::disassembleFunctions() {
       continue;
     }
 
+    uint64_t ContentHash = 0;
+    if (UseDisassemblyCache) {
+      ContentHash = xxh3_64bits(*FunctionData);
+      auto It = CachedFailures.find(Function.getAddress());
+      if (It != CachedFailures.end() && It->second == ContentHash) {
+        if (opts::Verbosity >= 1)
+          BC->outs() << "BOLT-INFO: function " << Function
+                     << " failed to disassemble in a previous run. Will "
+                        "ignore.\n";
+        // The partial disassembly would have registered references to other
+        // functions, such as secondary entry points. Scan for them instead.
+        {
+          NamedRegionTimer T("scan", "scan functions", "buildfuncs",
+                             "Scan Binary Functions", opts::TimeBuild);
+          Function.scanExternalRefs();
+        }
+        Function.setIgnored();
+        Failures.emplace_back(Function.getAddress(), ContentHash);
+        continue;
+      }
+    }
+
     bool DisasmFailed{false};
     handleAllErrors(Function.disassemble(), [&](const BOLTError &E) {
       DisasmFailed = true;
@@ -3266,13 +3316,29 @@ void RewriteInstance::disassembleFunctions() {
       Function.setIgnored();
     });
 
-    if (DisasmFailed)
+    if (DisasmFailed) {
+      if (UseDisassemblyCache)
+        Failures.emplace_back(Function.getAddress(), ContentHash);
       continue;
+    }
 
     if (opts::PrintAll || opts::PrintDisasm)
       Function.print(BC->outs(), "after disassembly");
   }
 
+  if (UseDisassemblyCache) {
+    std::error_code EC;
+    raw_fd_ostream OS(opts::DisassemblyCacheFile, EC, sys::fs::OF_Text);
+    if (EC) {
+      BC->errs() << "BOLT-WARNING: cannot write disassembly cache "
+                 << opts::DisassemblyCacheFile << ": " << EC.message() << '\n';
+    } else {
+      for (const auto &[Address, Hash] : Failures)
+        OS << Twine::utohexstr(Address) << ' ' << Twine::utohexstr(Hash)
+           << '\n';
+    }
+  }
+
   BC->processInterproceduralReferences();
   BC->populateJumpTables();
 
@@ -0,0 +1,52 @@
+# Check that a function ignored because of a previous disassembly failure
+# recorded in -disassembly-cache still has its references to other functions
+# scanned, so that the cached run produces the same output as the first one.
+
+# REQUIRES: system-linux
+
+# RUN: llvm-mc -filetype=obj -triple x86_64-unknown-unknown %s -o %t.o
+# RUN: %clang %cflags -no-pie %t.o -o %t.exe
+# RUN: rm -f %t.cache
+# RUN: llvm-bolt %t.exe -o %t.first --disassembly-cache=%t.cache -v=1 \
+# RUN:   | FileCheck %s --check-prefix=CHECK-FIRST
+# RUN: llvm-bolt %t.exe -o %t.cached --disassembly-cache=%t.cache -v=1 \
+# RUN:   | FileCheck %s --check-prefix=CHECK-CACHED
+# RUN: cmp %t.first %t.cached
+# RUN: %t.cached
+
+# CHECK-FIRST: BOLT-INFO: could not disassemble function bad
+# CHECK-CACHED: BOLT-INFO: function bad failed to disassemble in a previous run
+
+  .text
+  .globl main
+  .type main, %function
+main:
+  .cfi_startproc
+  callq foo
+  xorl %eax, %eax
+  retq
+  .cfi_endproc
+  .size main, .-main
+
+  .globl foo
+  .type foo, %function
+foo:
+  .cfi_startproc
+  nop
+.Lfoo_secondary:
+  movl $1, %eax
+  retq
+  .cfi_endproc
+  .size foo, .-foo
+
+# Jumps into the middle of foo, which makes that offset an entry point of foo,
+# and then contains an instruction that is invalid in 64-bit mode.
+  .globl bad
+  .type bad, %function
+bad:
+  .cfi_startproc
+  jmp .Lfoo_secondary
+  .byte 0x06
+  retq
+  .cfi_endproc
+  .size bad, .-bad
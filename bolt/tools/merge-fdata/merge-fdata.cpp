@@ -23,6 +23,7 @@
 #include "llvm/Support/ThreadPool.h"
 #include <algorithm>
 #include <mutex>
+#include <optional>
 #include <unordered_map>
 
 using namespace llvm;
@@ -68,6 +69,14 @@ SuppressMergedDataOutput("q",
   cl::Optional,
   cl::cat(MergeFdataCategory));
 
+static cl::opt<uint64_t>
+MinExecCount("min-exec-count",
+  cl::desc("drop functions executed fewer times than this from the merged "
+           "YAML profile"),
+  cl::init(0),
+  cl::Optional,
+  cl::cat(MergeFdataCategory));
+
 static cl::opt<std::string>
 OutputFilePath("o",
   cl::value_desc("file"),
@@ -91,6 +100,18 @@ static void report_error(Twine Message, StringRef CustomError) {
   exit(1);
 }
 
+// Merging may run on a thread pool, where the tool must not exit. Errors are
+// created with the message report_error() would print and reported later.
+static Error createMergeError(const Twine &Message, StringRef CustomError) {
+  return createStringError(inconvertibleErrorCode(),
+                           "'" + Message + "': " + CustomError);
+}
+
+static void report_error(Error E) {
+  errs() << ToolName << ": " << toString(std::move(E)) << ".\n";
+  exit(1);
+}
+
 static raw_fd_ostream &output() {
   if (opts::OutputFilePath.empty() || opts::OutputFilePath == "-")
     return outs();
@@ -147,16 +168,16 @@ void mergeProfileHeaders(BinaryProfileHeader &MergedHeader,
   }
 }
 
-void mergeBasicBlockProfile(BinaryBasicBlockProfile &MergedBB,
-                            BinaryBasicBlockProfile &&BB,
-                            const BinaryFunctionProfile &BF) {
+Error mergeBasicBlockProfile(BinaryBasicBlockProfile &MergedBB,
+                             BinaryBasicBlockProfile &&BB,
+                             const BinaryFunctionProfile &BF) {
   // Verify that the blocks match.
   if (BB.NumInstructions != MergedBB.NumInstructions)
-    report_error(BF.Name + " : BB #" + Twine(BB.Index),
-                 "number of instructions in block mismatch");
+    return createMergeError(BF.Name + " : BB #" + Twine(BB.Index),
+                            "number of instructions in block mismatch");
   if (BB.Hash != MergedBB.Hash)
-    report_error(BF.Name + " : BB #" + Twine(BB.Index),
-                 "basic block hash mismatch");
+    return createMergeError(BF.Name + " : BB #" + Twine(BB.Index),
+                            "basic block hash mismatch");
 
   // Update the execution count.
   MergedBB.ExecCount += BB.ExecCount;
@@ -191,7 +212,7 @@ void mergeBasicBlockProfile(BinaryBasicBlockProfile &MergedBB,
   std::vector<SuccessorInfo *> SIByIndex(BF.NumBasicBlocks);
   for (SuccessorInfo &SI : BB.Successors) {
     if (SI.Index >= BF.NumBasicBlocks)
-      report_error(BF.Name, "bad successor index");
+      return createMergeError(BF.Name, "bad successor index");
     SIByIndex[SI.Index] = &SI;
   }
   for (SuccessorInfo &MergedSI : MergedBB.Successors) {
@@ -207,17 +228,18 @@ void mergeBasicBlockProfile(BinaryBasicBlockProfile &MergedBB,
   for (SuccessorInfo *SI : SIByIndex)
     if (SI)
       MergedBB.Successors.emplace_back(std::move(*SI));
+  return Error::success();
 }
 
-void mergeFunctionProfile(BinaryFunctionProfile &MergedBF,
-                          BinaryFunctionProfile &&BF) {
+Error mergeFunctionProfile(BinaryFunctionProfile &MergedBF,
+                           BinaryFunctionProfile &&BF) {
   // Validate that we are merging the correct function.
   if (BF.NumBasicBlocks != MergedBF.NumBasicBlocks)
-    report_error(BF.Name, "number of basic blocks mismatch");
+    return createMergeError(BF.Name, "number of basic blocks mismatch");
   if (BF.Id != MergedBF.Id)
-    report_error(BF.Name, "ID mismatch");
+    return createMergeError(BF.Name, "ID mismatch");
   if (BF.Hash != MergedBF.Hash)
-    report_error(BF.Name, "hash mismatch");
+    return createMergeError(BF.Name, "hash mismatch");
 
   // Update the execution count.
   MergedBF.ExecCount += BF.ExecCount;
@@ -226,8 +248,8 @@ void mergeFunctionProfile(BinaryFunctionProfile &MergedBF,
   std::vector<BinaryBasicBlockProfile *> BlockByIndex(BF.NumBasicBlocks);
   for (BinaryBasicBlockProfile &BB : BF.Blocks) {
     if (BB.Index >= BF.NumBasicBlocks)
-      report_error(BF.Name + " : BB #" + Twine(BB.Index),
-                   "bad basic block index");
+      return createMergeError(BF.Name + " : BB #" + Twine(BB.Index),
+                              "bad basic block index");
     BlockByIndex[BB.Index] = &BB;
   }
   for (BinaryBasicBlockProfile &MergedBB : MergedBF.Blocks) {
@@ -235,7 +257,8 @@ void mergeFunctionProfile(BinaryFunctionProfile &MergedBF,
       continue;
     BinaryBasicBlockProfile &BB = *BlockByIndex[MergedBB.Index];
 
-    mergeBasicBlockProfile(MergedBB, std::move(BB), MergedBF);
+    if (Error E = mergeBasicBlockProfile(MergedBB, std::move(BB), MergedBF))
+      return E;
 
     // Ignore this block in the future.
     BlockByIndex[MergedBB.Index] = nullptr;
@@ -245,6 +268,7 @@ void mergeFunctionProfile(BinaryFunctionProfile &MergedBF,
   for (BinaryBasicBlockProfile *BB : BlockByIndex)
     if (BB)
       MergedBF.Blocks.emplace_back(std::move(*BB));
+  return Error::success();
 }
 
 bool isYAML(const StringRef Filename) {
@@ -383,43 +407,118 @@ int main(int argc, char **argv) {
   BinaryProfileHeader MergedHeader;
   MergedHeader.Version = 1;
 
-  // Merged information for all functions.
-  StringMap<BinaryFunctionProfile> MergedBFs;
-
-  for (std::string &InputDataFilename : Inputs) {
-    ErrorOr<std::unique_ptr<MemoryBuffer>> MB =
-        MemoryBuffer::getFileOrSTDIN(InputDataFilename);
-    if (std::error_code EC = MB.getError())
-      report_error(InputDataFilename, EC);
-    yaml::Input YamlInput(MB.get()->getBuffer());
-
-    errs() << "Merging data from " << InputDataFilename << "...\n";
-
-    BinaryProfile BP;
-    YamlInput >> BP;
-    if (YamlInput.error())
-      report_error(InputDataFilename, YamlInput.error());
-
-    // Sanity check.
-    if (BP.Header.Version != 1) {
-      errs() << "Unable to merge data from profile using version "
-             << BP.Header.Version << '\n';
-      exit(1);
+  // Input files are parsed in parallel, a batch at a time, so that only a
+  // bounded number of parsed profiles is held in memory. The functions of a
+  // batch are then merged by one task per shard of function names. Each shard
+  // visits the batch in input order, and the merged functions are finally
+  // inserted in the order in which they were first seen, so the result is the
+  // same as merging the files one after another.
+  DefaultThreadPool Pool(optimal_concurrency(Inputs.size()));
+  const unsigned NumShards = Pool.getMaxConcurrency();
+  const size_t BatchSize = 2 * NumShards;
+
+  // A function merged by a shard, with the input and index within that input
+  // of its first occurrence.
+  struct ShardedBF {
+    std::pair<size_t, size_t> FirstSeen;
+    BinaryFunctionProfile BF;
+  };
+  std::vector<StringMap<ShardedBF>> ShardedBFs(NumShards);
+
+  for (size_t Begin = 0; Begin < Inputs.size(); Begin += BatchSize) {
+    ArrayRef<std::string> Batch =
+        ArrayRef(Inputs).drop_front(Begin).take_front(BatchSize);
+    std::vector<BinaryProfile> Profiles(Batch.size());
+    std::vector<std::optional<Error>> ParseErrors(Batch.size());
+    for (size_t I = 0; I < Batch.size(); ++I) {
+      errs() << "Merging data from " << Batch[I] << "...\n";
+      Pool.async([&, I] {
+        ErrorOr<std::unique_ptr<MemoryBuffer>> MB =
+            MemoryBuffer::getFileOrSTDIN(Batch[I]);
+        if (std::error_code EC = MB.getError()) {
+          ParseErrors[I] = createMergeError(Batch[I], EC.message());
+          return;
+        }
+        yaml::Input YamlInput(MB.get()->getBuffer());
+        YamlInput >> Profiles[I];
+        if (YamlInput.error())
+          ParseErrors[I] =
+              createMergeError(Batch[I], YamlInput.error().message());
+      });
     }
-
-    // Merge the header.
-    mergeProfileHeaders(MergedHeader, BP.Header);
-
-    // Do the function merge.
-    for (BinaryFunctionProfile &BF : BP.Functions) {
-      if (!MergedBFs.count(BF.Name)) {
-        MergedBFs.insert(std::make_pair(BF.Name, BF));
-        continue;
+    Pool.wait();
+    for (std::optional<Error> &E : ParseErrors)
+      if (E)
+        report_error(std::move(*E));
+
+    for (BinaryProfile &BP : Profiles) {
+      // Sanity check.
+      if (BP.Header.Version != 1) {
+        errs() << "Unable to merge data from profile using version "
+               << BP.Header.Version << '\n';
+        exit(1);
       }
 
-      BinaryFunctionProfile &MergedBF = MergedBFs.find(BF.Name)->second;
-      mergeFunctionProfile(MergedBF, std::move(BF));
+      // Merge the header.
+      mergeProfileHeaders(MergedHeader, BP.Header);
     }
+
+    // Do the function merge. Each shard stops at its first error, and the
+    // earliest of those is the one a sequential merge would have reported.
+    std::vector<std::optional<std::pair<std::pair<size_t, size_t>, Error>>>
+        MergeErrors(NumShards);
+    for (unsigned Shard = 0; Shard < NumShards; ++Shard) {
+      Pool.async([&, Shard] {
+        StringMap<ShardedBF> &MergedBFs = ShardedBFs[Shard];
+        for (size_t I = 0; I < Profiles.size(); ++I) {
+          std::vector<BinaryFunctionProfile> &BFs = Profiles[I].Functions;
+          for (size_t J = 0; J < BFs.size(); ++J) {
+            BinaryFunctionProfile &BF = BFs[J];
+            if (hash_value(BF.Name) % NumShards != Shard)
+              continue;
+            std::pair<size_t, size_t> Position(Begin + I, J);
+            auto [It, Inserted] = MergedBFs.try_emplace(BF.Name);
+            if (Inserted) {
+              It->second.FirstSeen = Position;
+              It->second.BF = std::move(BF);
+            } else if (Error E =
+                           mergeFunctionProfile(It->second.BF, std::move(BF))) {
+              MergeErrors[Shard].emplace(Position, std::move(E));
+              return;
+            }
+          }
+        }
+      });
+    }
+    Pool.wait();
+    std::optional<std::pair<std::pair<size_t, size_t>, Error>> *FirstError =
+        nullptr;
+    for (auto &E : MergeErrors)
+      if (E && (!FirstError || E->first < (*FirstError)->first))
+        FirstError = &E;
+    if (FirstError)
+      report_error(std::move((*FirstError)->second));
+  }
+
+  // Merged information for all functions, inserted in the order of a
+  // sequential merge so that iterating over it gives the same order.
+  std::vector<StringMapEntry<ShardedBF> *> FirstSeenOrder;
+  for (StringMap<ShardedBF> &Shard : ShardedBFs)
+    for (StringMapEntry<ShardedBF> &Entry : Shard)
+      FirstSeenOrder.push_back(&Entry);
+  llvm::sort(FirstSeenOrder, [](const StringMapEntry<ShardedBF> *A,
+                                const StringMapEntry<ShardedBF> *B) {
+    return A->second.FirstSeen < B->second.FirstSeen;
+  });
+  StringMap<BinaryFunctionProfile> MergedBFs;
+  for (StringMapEntry<ShardedBF> *Entry : FirstSeenOrder)
+    MergedBFs.try_emplace(Entry->first(), std::move(Entry->second.BF));
+  FirstSeenOrder.clear();
+  ShardedBFs.clear();
+  for (auto It = MergedBFs.begin(), End = MergedBFs.end(); It != End;) {
+    auto Cur = It++;
+    if (Cur->second.ExecCount < opts::MinExecCount)
+      MergedBFs.erase(Cur);
   }
 
   if (!opts::SuppressMergedDataOutput) {
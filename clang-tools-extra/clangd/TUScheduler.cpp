@@ -111,6 +111,13 @@ constexpr trace::Metric
 constexpr trace::Metric PreambleBuildFilesystemLatencyRatio(
     "preamble_fs_latency_ratio", trace::Metric::Distribution, "build_type");
 
+// Tracks the time (in seconds) a request spends queued on its ASTWorker,
+// including debounce and waiting for a free worker slot, before it starts to
+// run. Split by request name, e.g. "Update", "Hover", "CodeComplete".
+constexpr trace::Metric ASTWorkerQueueLatency("ast_worker_queue_latency",
+                                              trace::Metric::Distribution,
+                                              "request_name");
+
 constexpr trace::Metric PreambleBuildSize("preamble_build_size",
                                           trace::Metric::Distribution);
 constexpr trace::Metric PreambleSerializedSize("preamble_serialized_size",
@@ -1451,6 +1458,11 @@ void ASTWorker::run() {
         Lock.lock();
       }
       WithContext Guard(std::move(CurrentRequest->Ctx));
+      ASTWorkerQueueLatency.record(
+          std::chrono::duration<double>(steady_clock::now() -
+                                        CurrentRequest->AddTime)
+              .count(),
+          CurrentRequest->Name);
       Status.update([&](TUStatus &Status) {
         Status.ASTActivity.K = ASTAction::RunningAction;
         Status.ASTActivity.Name = CurrentRequest->Name;
@@ -8,6 +8,8 @@
 
 #include "../index/Serialization.h"
 #include "../index/dex/Dex.h"
+#include "../index/dex/Iterator.h"
+#include "../index/dex/PostingList.h"
 #include "benchmark/benchmark.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
@@ -97,6 +99,29 @@ static void dexBuild(benchmark::State &State) {
 }
 BENCHMARK(dexBuild);
 
+// Intersects a sparse posting list with a dense one, which is the shape of
+// most trigram queries: every advanceTo() on the dense list skips a few chunks.
+static void dexIntersection(benchmark::State &State) {
+  const dex::DocID Size = 1 << 20;
+  std::vector<dex::DocID> Dense, Sparse;
+  for (dex::DocID I = 0; I < Size; ++I) {
+    if (I % 3 == 0)
+      Dense.push_back(I);
+    if (I % State.range(0) == 0)
+      Sparse.push_back(I);
+  }
+  dex::PostingList DenseList(Dense), SparseList(Sparse);
+  dex::Corpus C(Size);
+  for (auto _ : State) {
+    std::vector<std::unique_ptr<dex::Iterator>> Children;
+    Children.push_back(DenseList.iterator());
+    Children.push_back(SparseList.iterator());
+    auto And = C.intersect(std::move(Children));
+    benchmark::DoNotOptimize(dex::consume(*And));
+  }
+}
+BENCHMARK(dexIntersection)->Arg(7)->Arg(100)->Arg(10000);
+
 } // namespace
 } // namespace clangd
 } // namespace clang
@@ -209,8 +209,13 @@ public:
   }
 };
 
+// The strings point into the input data, or into Storage if the table was
+// compressed, and are followed by the table's NUL separator so they can be used
+// as C strings (e.g. Ref::Location::FileURI). They are only valid while the
+// table and the input are alive; readers copy what they keep into their slabs.
 struct StringTableIn {
-  llvm::BumpPtrAllocator Arena;
+  // No inline storage, so that moving the table doesn't invalidate Strings.
+  llvm::SmallVector<uint8_t, 0> Storage;
   std::vector<llvm::StringRef> Strings;
 };
 
@@ -220,8 +225,8 @@ llvm::Expected<StringTableIn> readStringTable(llvm::StringRef Data) {
   if (R.err())
     return error("Truncated string table");
 
+  StringTableIn Table;
   llvm::StringRef Uncompressed;
-  llvm::SmallVector<uint8_t, 0> UncompressedStorage;
   if (UncompressedSize == 0) // No compression
     Uncompressed = R.rest();
   else if (llvm::compression::zlib::isAvailable()) {
@@ -235,21 +240,19 @@ llvm::Expected<StringTableIn> readStringTable(llvm::StringRef Data) {
                    R.rest().size(), UncompressedSize);
 
     if (llvm::Error E = llvm::compression::zlib::decompress(
-            llvm::arrayRefFromStringRef(R.rest()), UncompressedStorage,
+            llvm::arrayRefFromStringRef(R.rest()), Table.Storage,
             UncompressedSize))
       return std::move(E);
-    Uncompressed = toStringRef(UncompressedStorage);
+    Uncompressed = toStringRef(Table.Storage);
   } else
     return error("Compressed string table, but zlib is unavailable");
 
-  StringTableIn Table;
-  llvm::StringSaver Saver(Table.Arena);
   R = Reader(Uncompressed);
   for (Reader R(Uncompressed); !R.eof();) {
     auto Len = R.rest().find(0);
     if (Len == llvm::StringRef::npos)
       return error("Bad string table: not null terminated");
-    Table.Strings.push_back(Saver.save(R.consume(Len)));
+    Table.Strings.push_back(R.consume(Len));
     R.consume8();
   }
   if (R.err())
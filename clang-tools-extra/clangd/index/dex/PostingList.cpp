@@ -98,12 +98,26 @@ private:
   }
 
   /// Advances CurrentChunk to the chunk which might contain ID.
+  ///
+  /// Intersections mostly advance to a nearby ID, so this gallops forward in
+  /// steps of 1, 2, 4... chunks before binary searching the last step: that
+  /// costs O(log distance) instead of O(log remaining chunks).
   void advanceToChunk(DocID ID) {
     if ((CurrentChunk != Chunks.end() - 1) &&
         ((CurrentChunk + 1)->Head <= ID)) {
+      auto Low = CurrentChunk + 1;
+      size_t Step = 1;
+      while (static_cast<size_t>(Chunks.end() - Low) > Step &&
+             Low[Step].Head <= ID) {
+        Low += Step;
+        Step *= 2;
+      }
+      auto High = static_cast<size_t>(Chunks.end() - Low) > Step
+                      ? Low + Step
+                      : Chunks.end();
       CurrentChunk =
-          std::partition_point(CurrentChunk + 1, Chunks.end(),
-                               [&](const Chunk &C) { return C.Head < ID; });
+          std::partition_point(Low + 1, High,
+                               [&](const Chunk &C) { return C.Head <= ID; });
       --CurrentChunk;
       DecompressedChunk = CurrentChunk->decompress();
       CurrentID = DecompressedChunk.begin();
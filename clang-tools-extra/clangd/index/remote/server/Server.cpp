@@ -22,6 +22,7 @@
 #include "support/ThreadsafeFS.h"
 #include "support/Trace.h"
 #include "llvm/ADT/IntrusiveRefCntPtr.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Chrono.h"
 #include "llvm/Support/CommandLine.h"
@@ -32,10 +33,13 @@
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/VirtualFileSystem.h"
 
+#include <atomic>
 #include <chrono>
 #include <grpc++/grpc++.h>
 #include <grpc++/health_check_service_interface.h>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <thread>
@@ -111,8 +115,76 @@ llvm::cl::opt<size_t> LimitResults(
                    "single request. Limit is to keep the server from being "
                    "DOS'd. Defaults to 10000."));
 
+llvm::cl::opt<size_t> ReplyCacheSize(
+    "reply-cache-size", llvm::cl::init(0),
+    llvm::cl::desc("Maximum number of Lookup and Refs responses (each) to keep "
+                   "in an LRU cache, so that repeated requests are answered "
+                   "without querying the index. Defaults to 0 (disabled)."));
+
 static Key<grpc::ServerContext *> CurrentRequest;
 
+// Bumped whenever a new index version is loaded, invalidating cached replies.
+std::atomic<unsigned> IndexGeneration{0};
+
+// Counts reply cache lookups, e.g. "Lookup_hit" or "Refs_miss".
+constexpr trace::Metric ReplyCacheAccess("remote_index_reply_cache",
+                                         trace::Metric::Counter, "result");
+
+// A thread-safe LRU cache of the full stream of replies for a request, keyed
+// by the serialized request.
+template <typename ReplyT> class ReplyCache {
+public:
+  ReplyCache(llvm::StringLiteral RequestName) : RequestName(RequestName) {}
+
+  std::optional<std::vector<ReplyT>> get(const std::string &Key) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    invalidateIfStaleLocked();
+    auto It = Map.find(Key);
+    if (It == Map.end()) {
+      ReplyCacheAccess.record(1, (RequestName + "_miss").str());
+      return std::nullopt;
+    }
+    ReplyCacheAccess.record(1, (RequestName + "_hit").str());
+    LRU.splice(LRU.begin(), LRU, It->second);
+    return It->second->second;
+  }
+
+  // \p RequestGeneration is the IndexGeneration from before the index was
+  // queried; replies computed from an index that has since been replaced are
+  // dropped.
+  void put(std::string Key, std::vector<ReplyT> Replies,
+           unsigned RequestGeneration) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    invalidateIfStaleLocked();
+    if (RequestGeneration != Generation || Map.count(Key))
+      return;
+    LRU.emplace_front(Key, std::move(Replies));
+    Map[Key] = LRU.begin();
+    if (LRU.size() > ReplyCacheSize) {
+      Map.erase(LRU.back().first);
+      LRU.pop_back();
+    }
+  }
+
+private:
+  void invalidateIfStaleLocked() {
+    unsigned Current = IndexGeneration.load();
+    if (Generation == Current)
+      return;
+    Generation = Current;
+    LRU.clear();
+    Map.clear();
+  }
+
+  llvm::StringLiteral RequestName;
+  std::mutex Mutex;
+  unsigned Generation = 0;
+  std::list<std::pair<std::string, std::vector<ReplyT>>> LRU;
+  llvm::StringMap<
+      typename std::list<std::pair<std::string, std::vector<ReplyT>>>::iterator>
+      Map;
+};
+
 class RemoteIndexServer final : public v1::SymbolIndex::Service {
 public:
   RemoteIndexServer(clangd::SymbolIndex &Index, llvm::StringRef IndexRoot)
@@ -134,6 +206,18 @@ private:
     WithContextValue WithRequestContext(CurrentRequest, Context);
     logRequest(*Request);
     trace::Span Tracer("LookupRequest");
+    std::string CacheKey;
+    unsigned Generation = IndexGeneration.load();
+    if (ReplyCacheSize) {
+      CacheKey = Request->SerializeAsString();
+      if (auto Cached = LookupCache.get(CacheKey)) {
+        for (const LookupReply &Message : *Cached)
+          Reply->Write(Message);
+        SPAN_ATTACH(Tracer, "Cached", true);
+        logRequestSummary("v1/Lookup", Cached->size() - 1, StartTime);
+        return grpc::Status::OK;
+      }
+    }
     auto Req = ProtobufMarshaller->fromProtobuf(Request);
     if (!Req) {
       elog("Can not parse LookupRequest from protobuf: {0}", Req.takeError());
@@ -142,6 +226,7 @@ private:
     unsigned Sent = 0;
     unsigned FailedToSend = 0;
     bool HasMore = false;
+    std::vector<LookupReply> ToCache;
     Index.lookup(*Req, [&](const clangd::Symbol &Item) {
       if (Sent >= LimitResults) {
         HasMore = true;
@@ -158,6 +243,8 @@ private:
       *NextMessage.mutable_stream_result() = *SerializedItem;
       logResponse(NextMessage);
       Reply->Write(NextMessage);
+      if (ReplyCacheSize)
+        ToCache.push_back(std::move(NextMessage));
       ++Sent;
     });
     if (HasMore)
@@ -166,6 +253,10 @@ private:
     LastMessage.mutable_final_result()->set_has_more(HasMore);
     logResponse(LastMessage);
     Reply->Write(LastMessage);
+    if (ReplyCacheSize) {
+      ToCache.push_back(std::move(LastMessage));
+      LookupCache.put(std::move(CacheKey), std::move(ToCache), Generation);
+    }
     SPAN_ATTACH(Tracer, "Sent", Sent);
     SPAN_ATTACH(Tracer, "Failed to send", FailedToSend);
     logRequestSummary("v1/Lookup", Sent, StartTime);
@@ -222,6 +313,18 @@ private:
     WithContextValue WithRequestContext(CurrentRequest, Context);
     logRequest(*Request);
     trace::Span Tracer("RefsRequest");
+    std::string CacheKey;
+    unsigned Generation = IndexGeneration.load();
+    if (ReplyCacheSize) {
+      CacheKey = Request->SerializeAsString();
+      if (auto Cached = RefsCache.get(CacheKey)) {
+        for (const RefsReply &Message : *Cached)
+          Reply->Write(Message);
+        SPAN_ATTACH(Tracer, "Cached", true);
+        logRequestSummary("v1/Refs", Cached->size() - 1, StartTime);
+        return grpc::Status::OK;
+      }
+    }
     auto Req = ProtobufMarshaller->fromProtobuf(Request);
     if (!Req) {
       elog("Can not parse RefsRequest from protobuf: {0}", Req.takeError());
@@ -234,6 +337,7 @@ private:
     }
     unsigned Sent = 0;
     unsigned FailedToSend = 0;
+    std::vector<RefsReply> ToCache;
     bool HasMore = Index.refs(*Req, [&](const clangd::Ref &Item) {
       auto SerializedItem = ProtobufMarshaller->toProtobuf(Item);
       if (!SerializedItem) {
@@ -246,12 +350,18 @@ private:
       *NextMessage.mutable_stream_result() = *SerializedItem;
       logResponse(NextMessage);
       Reply->Write(NextMessage);
+      if (ReplyCacheSize)
+        ToCache.push_back(std::move(NextMessage));
       ++Sent;
     });
     RefsReply LastMessage;
     LastMessage.mutable_final_result()->set_has_more(HasMore);
     logResponse(LastMessage);
     Reply->Write(LastMessage);
+    if (ReplyCacheSize) {
+      ToCache.push_back(std::move(LastMessage));
+      RefsCache.put(std::move(CacheKey), std::move(ToCache), Generation);
+    }
     SPAN_ATTACH(Tracer, "Sent", Sent);
     SPAN_ATTACH(Tracer, "Failed to send", FailedToSend);
     logRequestSummary("v1/Refs", Sent, StartTime);
@@ -330,6 +440,8 @@ private:
 
   std::unique_ptr<Marshaller> ProtobufMarshaller;
   clangd::SymbolIndex &Index;
+  ReplyCache<LookupReply> LookupCache{"Lookup"};
+  ReplyCache<RefsReply> RefsCache{"Refs"};
 };
 
 class Monitor final : public v1::Monitor::Service {
@@ -402,6 +514,7 @@ void hotReload(clangd::SwapIndex &Index, llvm::StringRef IndexPath,
     return;
   }
   Index.reset(std::move(NewIndex));
+  ++IndexGeneration;
   Monitor.updateIndex(Status->getLastModificationTime());
   log("New index version loaded. Last modification time: {0}, size: {1} bytes.",
       Status->getLastModificationTime(), Status->getSize());
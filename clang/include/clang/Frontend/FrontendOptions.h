@@ -579,6 +579,9 @@ public:
   /// Path which stores the output files for -ftime-trace
   std::string TimeTracePath;
 
+  /// Path which stores the aggregated time summary for -ftime-trace-summary=
+  std::string TimeTraceSummaryPath;
+
   /// Output Path for module output file.
   std::string ModuleOutputPath;
 
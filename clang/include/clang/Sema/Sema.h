@@ -10387,6 +10387,32 @@ public:
   // FIXME: Does this belong in Sema? It's tough to implement it anywhere else.
   unsigned LastEmittedCodeSynthesisContextDepth = 0;
 
+  /// Statistics about the definitions instantiated from one pattern,
+  /// collected when \c CollectStats is set and printed by \c PrintStats().
+  struct TemplateInstantiationStats {
+    unsigned Count = 0;
+    unsigned MaxDepth = 0;
+    /// Wall time spent instantiating, including nested instantiations.
+    double Seconds = 0;
+  };
+  llvm::DenseMap<const NamedDecl *, TemplateInstantiationStats>
+      InstantiationStats;
+
+  /// A stack object that records the instantiation of a definition from
+  /// \p Pattern in \c InstantiationStats. Does nothing unless statistics
+  /// are being collected.
+  class InstantiationStatsScope {
+    Sema &S;
+    const NamedDecl *Pattern;
+    uint64_t StartNanos = 0;
+
+  public:
+    InstantiationStatsScope(Sema &S, const NamedDecl *Pattern);
+    ~InstantiationStatsScope();
+    InstantiationStatsScope(const InstantiationStatsScope &) = delete;
+    InstantiationStatsScope &operator=(const InstantiationStatsScope &) = delete;
+  };
+
   /// The template instantiation callbacks to trace or track
   /// instantiations (objects can be chained).
   ///
@@ -86,10 +86,14 @@ public:
   /// file format that is specified in the options (-MD is the default) and
   /// return it.
   ///
+  /// \param FileDeps If non-null, receives the list of file dependencies
+  /// that were printed.
+  ///
   /// \returns A \c StringError with the diagnostic output if clang errors
   /// occurred, dependency file contents otherwise.
   llvm::Expected<std::string>
-  getDependencyFile(const std::vector<std::string> &CommandLine, StringRef CWD);
+  getDependencyFile(const std::vector<std::string> &CommandLine, StringRef CWD,
+                    std::vector<std::string> *FileDeps = nullptr);
 
   /// Collect the module dependency in P1689 format for C++20 named modules.
   ///
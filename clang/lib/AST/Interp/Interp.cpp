@@ -38,22 +38,35 @@ static bool RetValue(InterpState &S, CodePtr &Pt, APValue &Result) {
 // Jmp, Jt, Jf
 //===----------------------------------------------------------------------===//
 
-static bool Jmp(InterpState &S, CodePtr &PC, int32_t Offset) {
+/// Loops are the only way to run unbounded code without recursion, so count
+/// backward jumps against -fconstexpr-steps the way the tree evaluator counts
+/// statements.
+static bool takeJump(InterpState &S, CodePtr &PC, int32_t Offset) {
+  if (Offset < 0) {
+    if (!S.StepsLeft) {
+      S.FFDiag(S.Current->getSource(PC),
+               diag::note_constexpr_step_limit_exceeded);
+      return false;
+    }
+    --S.StepsLeft;
+  }
   PC += Offset;
   return true;
 }
 
+static bool Jmp(InterpState &S, CodePtr &PC, int32_t Offset) {
+  return takeJump(S, PC, Offset);
+}
+
 static bool Jt(InterpState &S, CodePtr &PC, int32_t Offset) {
-  if (S.Stk.pop<bool>()) {
-    PC += Offset;
-  }
+  if (S.Stk.pop<bool>())
+    return takeJump(S, PC, Offset);
   return true;
 }
 
 static bool Jf(InterpState &S, CodePtr &PC, int32_t Offset) {
-  if (!S.Stk.pop<bool>()) {
-    PC += Offset;
-  }
+  if (!S.Stk.pop<bool>())
+    return takeJump(S, PC, Offset);
   return true;
 }
 
@@ -17,7 +17,8 @@ using namespace clang::interp;
 
 InterpState::InterpState(State &Parent, Program &P, InterpStack &Stk,
                          Context &Ctx, SourceMapper *M)
-    : Parent(Parent), M(M), P(P), Stk(Stk), Ctx(Ctx), Current(nullptr) {}
+    : Parent(Parent), M(M), P(P), Stk(Stk), Ctx(Ctx), Current(nullptr),
+      StepsLeft(Parent.getCtx().getLangOpts().ConstexprStepLimit) {}
 
 InterpState::~InterpState() {
   while (Current) {
@@ -121,6 +121,9 @@ public:
   InterpFrame *Current = nullptr;
   /// Source location of the evaluating expression
   SourceLocation EvalLocation;
+  /// The remaining number of backward jumps the evaluation may take before
+  /// hitting -fconstexpr-steps.
+  unsigned StepsLeft;
 };
 
 } // namespace interp
@@ -609,8 +609,12 @@ public:
     Key.Traversal = Ctx.getParentMapContext().getTraversalKind();
     // Memoize result even doing a single-level match, it might be expensive.
     Key.Type = MaxDepth == 1 ? MatchType::Child : MatchType::Descendants;
-    MemoizationMap::iterator I = ResultCache.find(Key);
-    if (I != ResultCache.end()) {
+    // Comparing keys (including their bound nodes) is not cheap, so remember
+    // the position and use it as a hint when inserting below, unless the
+    // recursive match cleared the cache in the meantime.
+    unsigned Generation = ResultCacheGeneration;
+    MemoizationMap::iterator I = ResultCache.lower_bound(Key);
+    if (I != ResultCache.end() && !(Key < I->first)) {
       *Builder = I->second.Nodes;
       return I->second.ResultOfMatch;
     }
@@ -620,7 +624,10 @@ public:
     Result.ResultOfMatch =
         matchesRecursively(Node, Matcher, &Result.Nodes, MaxDepth, Bind);
 
-    MemoizedMatchResult &CachedResult = ResultCache[Key];
+    if (Generation != ResultCacheGeneration)
+      I = ResultCache.end();
+    MemoizedMatchResult &CachedResult =
+        ResultCache.try_emplace(I, std::move(Key))->second;
     CachedResult = std::move(Result);
 
     *Builder = CachedResult.Nodes;
@@ -667,12 +674,18 @@ public:
                               bool Directly) override;
 
 public:
+  void resetResultCacheIfFull() {
+    if (ResultCache.size() > MaxMemoizationEntries) {
+      ResultCache.clear();
+      ++ResultCacheGeneration;
+    }
+  }
+
   // Implements ASTMatchFinder::matchesChildOf.
   bool matchesChildOf(const DynTypedNode &Node, ASTContext &Ctx,
                       const DynTypedMatcher &Matcher,
                       BoundNodesTreeBuilder *Builder, BindKind Bind) override {
-    if (ResultCache.size() > MaxMemoizationEntries)
-      ResultCache.clear();
+    resetResultCacheIfFull();
     return memoizedMatchesRecursively(Node, Ctx, Matcher, Builder, 1, Bind);
   }
   // Implements ASTMatchFinder::matchesDescendantOf.
@@ -680,8 +693,7 @@ public:
                            const DynTypedMatcher &Matcher,
                            BoundNodesTreeBuilder *Builder,
                            BindKind Bind) override {
-    if (ResultCache.size() > MaxMemoizationEntries)
-      ResultCache.clear();
+    resetResultCacheIfFull();
     return memoizedMatchesRecursively(Node, Ctx, Matcher, Builder, INT_MAX,
                                       Bind);
   }
@@ -692,8 +704,7 @@ public:
                          AncestorMatchMode MatchMode) override {
     // Reset the cache outside of the recursive call to make sure we
     // don't invalidate any iterators.
-    if (ResultCache.size() > MaxMemoizationEntries)
-      ResultCache.clear();
+    resetResultCacheIfFull();
     if (MatchMode == AncestorMatchMode::AMM_ParentOnly)
       return matchesParentOf(Node, Matcher, Builder);
     return matchesAnyAncestorOf(Node, Ctx, Matcher, Builder);
@@ -1154,10 +1165,19 @@ private:
     // These are the memoizable nodes in the chain of unique parents, which
     // terminates when a node has multiple parents, or matches, or is the root.
     std::vector<MatchKey> Keys;
+    // The cache positions of Keys, used as insertion hints as long as the
+    // cache isn't cleared by a nested match.
+    std::vector<MemoizationMap::iterator> Hints;
+    unsigned Generation = ResultCacheGeneration;
     // When returning, update the memoization cache.
     auto Finish = [&](bool Matched) {
-      for (const auto &Key : Keys) {
-        MemoizedMatchResult &CachedResult = ResultCache[Key];
+      bool UseHints = Generation == ResultCacheGeneration;
+      for (auto [Key, Hint] : llvm::zip_equal(Keys, Hints)) {
+        MemoizedMatchResult &CachedResult =
+            ResultCache
+                .try_emplace(UseHints ? Hint : ResultCache.end(),
+                             std::move(Key))
+                ->second;
         CachedResult.ResultOfMatch = Matched;
         CachedResult.Nodes = *Builder;
       }
@@ -1177,12 +1197,13 @@ private:
         Keys.back().Type = MatchType::Ancestors;
 
         // Check the cache.
-        MemoizationMap::iterator I = ResultCache.find(Keys.back());
-        if (I != ResultCache.end()) {
+        MemoizationMap::iterator I = ResultCache.lower_bound(Keys.back());
+        if (I != ResultCache.end() && !(Keys.back() < I->first)) {
           Keys.pop_back(); // Don't populate the cache for the matching node!
           *Builder = I->second.Nodes;
           return Finish(I->second.ResultOfMatch);
         }
+        Hints.push_back(I);
       }
 
       Parents = ActiveASTContext->getParents(Node);
@@ -1342,6 +1363,8 @@ private:
   // Maps (matcher, node) -> the match result for memoization.
   typedef std::map<MatchKey, MemoizedMatchResult> MemoizationMap;
   MemoizationMap ResultCache;
+  // Incremented whenever ResultCache is cleared, invalidating its iterators.
+  unsigned ResultCacheGeneration = 0;
 };
 
 static CXXRecordDecl *
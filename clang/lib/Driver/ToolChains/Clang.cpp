@@ -6795,6 +6795,11 @@ void Clang::ConstructJob(Compilation &C, const JobAction &JA,
     CmdArgs.push_back(Args.MakeArgString("-ftime-trace=" + Twine(Name)));
     Args.AddLastArg(CmdArgs, options::OPT_ftime_trace_granularity_EQ);
   }
+  if (Args.hasArg(options::OPT_ftime_trace_summary_EQ)) {
+    Args.AddLastArg(CmdArgs, options::OPT_ftime_trace_summary_EQ);
+    if (!C.getTimeTraceFile(&JA))
+      Args.AddLastArg(CmdArgs, options::OPT_ftime_trace_granularity_EQ);
+  }
 
   if (Arg *A = Args.getLastArg(options::OPT_ftrapv_handler_EQ)) {
     CmdArgs.push_back("-ftrapv-handler");
@@ -1226,16 +1226,24 @@ private:
     ++Count;
 
     unsigned Penalty = 0;
+    StateNode *Best = nullptr;
 
     // While not empty, take first element and follow edges.
     while (!Queue.empty()) {
-      // Quit if we still haven't found a solution by now.
-      if (Count > 25'000'000)
-        return 0;
-
       Penalty = Queue.top().first.first;
       StateNode *Node = Queue.top().second;
+
+      // If we still haven't found a solution by now, complete the cheapest
+      // partial one greedily rather than exploring further.
+      if (Count > 25'000'000) {
+        LLVM_DEBUG(llvm::dbgs()
+                   << "Search limit reached, completing greedily.\n");
+        Best = completeGreedily(Node, Penalty);
+        break;
+      }
+
       if (!Node->State.NextToken) {
+        Best = Node;
         LLVM_DEBUG(llvm::dbgs()
                    << "\n---\nPenalty for line: " << Penalty << "\n");
         break;
@@ -1259,7 +1267,7 @@ private:
         addNextStateToQueue(Penalty, Node, /*NewLine=*/true, &Count, &Queue);
     }
 
-    if (Queue.empty()) {
+    if (!Best) {
       // We were unable to find a solution, do nothing.
       // FIXME: Add diagnostic?
       LLVM_DEBUG(llvm::dbgs() << "Could not find a solution.\n");
@@ -1268,7 +1276,7 @@ private:
 
     // Reconstruct the solution.
     if (!DryRun)
-      reconstructPath(InitialState, Queue.top().second);
+      reconstructPath(InitialState, Best);
 
     LLVM_DEBUG(llvm::dbgs()
                << "Total number of analyzed states: " << Count << "\n");
@@ -1299,6 +1307,26 @@ private:
     ++(*Count);
   }
 
+  /// Extends \p Node to a complete solution by always taking the cheaper of the
+  /// next two states, preferring not to break on ties. Updates \p Penalty and
+  /// returns the final node, or null if no valid continuation exists.
+  StateNode *completeGreedily(StateNode *Node, unsigned &Penalty) {
+    while (Node->State.NextToken) {
+      QueueType Next;
+      unsigned Count = 0;
+      FormatDecision LastFormat = Node->State.NextToken->getDecision();
+      if (LastFormat == FD_Unformatted || LastFormat == FD_Continue)
+        addNextStateToQueue(Penalty, Node, /*NewLine=*/false, &Count, &Next);
+      if (LastFormat == FD_Unformatted || LastFormat == FD_Break)
+        addNextStateToQueue(Penalty, Node, /*NewLine=*/true, &Count, &Next);
+      if (Next.empty())
+        return nullptr;
+      Penalty = Next.top().first.first;
+      Node = Next.top().second;
+    }
+    return Node;
+  }
+
   /// Applies the best formatting by reconstructing the path in the
   /// solution space that leads to \c Best.
   void reconstructPath(LineState &State, StateNode *Best) {
@@ -51,6 +51,13 @@
 #include <nmmintrin.h>
 #endif
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif __ALTIVEC__
+#include <altivec.h>
+#undef bool
+#endif
+
 using namespace clang;
 
 //===----------------------------------------------------------------------===//
@@ -2588,6 +2595,32 @@ bool Lexer::SkipLineComment(Token &Result, const char *CurPtr,
 
   char C;
   while (true) {
+#ifdef __SSE2__
+    // Skip 16 bytes at a time while none of them is a newline, a NUL or a
+    // non-ASCII character.
+    if (CurPtr + 16 < BufferEnd) {
+      const __m128i Zeros = _mm_setzero_si128();
+      const __m128i Newlines = _mm_set1_epi8('\n');
+      const __m128i Returns = _mm_set1_epi8('\r');
+      const char *Start = CurPtr;
+      while (CurPtr + 16 < BufferEnd) {
+        __m128i V = _mm_loadu_si128((const __m128i *)CurPtr);
+        __m128i Special = _mm_or_si128(
+            _mm_cmpeq_epi8(V, Zeros),
+            _mm_or_si128(_mm_cmpeq_epi8(V, Newlines),
+                         _mm_cmpeq_epi8(V, Returns)));
+        // The sign bit is set for non-ASCII bytes.
+        int Mask = _mm_movemask_epi8(_mm_or_si128(V, Special));
+        if (Mask != 0) {
+          CurPtr += llvm::countr_zero<unsigned>(Mask);
+          break;
+        }
+        CurPtr += 16;
+      }
+      if (CurPtr != Start)
+        UnicodeDecodingAlreadyDiagnosed = false;
+    }
+#endif
     C = *CurPtr;
     // Skip over characters in the fast loop.
     while (isASCII(C) && C != 0 &&   // Potentially EOF.
@@ -2826,13 +2859,6 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
   return true;
 }
 
-#ifdef __SSE2__
-#include <emmintrin.h>
-#elif __ALTIVEC__
-#include <altivec.h>
-#undef bool
-#endif
-
 /// We have just read from input the / and * characters that started a comment.
 /// Read until we find the * and / characters that terminate the comment.
 /// Note that we don't bother decoding trigraphs or escaped newlines in block
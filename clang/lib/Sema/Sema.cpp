@@ -74,6 +74,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/Support/Format.h"
 #include "llvm/Support/TimeProfiler.h"
 #include <optional>
 
@@ -619,6 +620,31 @@ void Sema::PrintStats() const {
   llvm::errs() << "\n*** Semantic Analysis Stats:\n";
   llvm::errs() << NumSFINAEErrors << " SFINAE diagnostics trapped.\n";
 
+  if (!InstantiationStats.empty()) {
+    using Entry = std::pair<const NamedDecl *, TemplateInstantiationStats>;
+    SmallVector<Entry, 0> Entries(InstantiationStats.begin(),
+                                  InstantiationStats.end());
+    unsigned NumInstantiations = 0;
+    for (const Entry &E : Entries)
+      NumInstantiations += E.second.Count;
+    llvm::errs() << NumInstantiations << " template instantiations of "
+                 << Entries.size() << " patterns.\n";
+
+    // Report the patterns that took the longest to instantiate.
+    const size_t NumToPrint = std::min<size_t>(Entries.size(), 20);
+    std::partial_sort(Entries.begin(), Entries.begin() + NumToPrint,
+                      Entries.end(), [](const Entry &A, const Entry &B) {
+                        return A.second.Seconds > B.second.Seconds;
+                      });
+    for (const Entry &E : ArrayRef(Entries).take_front(NumToPrint)) {
+      llvm::errs() << llvm::format("  %8.4fs %6u instantiations, depth %3u: ",
+                                   E.second.Seconds, E.second.Count,
+                                   E.second.MaxDepth);
+      E.first->printQualifiedName(llvm::errs());
+      llvm::errs() << '\n';
+    }
+  }
+
   BumpAlloc.PrintStats();
   AnalysisWarnings.PrintStats();
 }
@@ -40,6 +40,7 @@
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/TimeProfiler.h"
+#include <chrono>
 #include <optional>
 
 using namespace clang;
@@ -924,6 +925,31 @@ bool Sema::InstantiatingTemplate::CheckInstantiationDepth(
   return true;
 }
 
+static uint64_t getSteadyNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+Sema::InstantiationStatsScope::InstantiationStatsScope(
+    Sema &S, const NamedDecl *Pattern)
+    : S(S), Pattern(S.CollectStats ? Pattern : nullptr) {
+  if (this->Pattern)
+    StartNanos = getSteadyNanos();
+}
+
+Sema::InstantiationStatsScope::~InstantiationStatsScope() {
+  if (!Pattern)
+    return;
+  TemplateInstantiationStats &Stats = S.InstantiationStats[Pattern];
+  ++Stats.Count;
+  // Count this instantiation, which is not on the stack yet.
+  Stats.MaxDepth = std::max<unsigned>(
+      Stats.MaxDepth,
+      S.CodeSynthesisContexts.size() - S.NonInstantiationEntries + 1);
+  Stats.Seconds += (getSteadyNanos() - StartNanos) * 1e-9;
+}
+
 /// Prints the current instantiation stack through a series of
 /// notes.
 void Sema::PrintInstantiationStack() {
@@ -3531,6 +3557,7 @@ Sema::InstantiateClass(SourceLocation PointOfInstantiation,
   });
 
   Pattern = PatternDef;
+  InstantiationStatsScope StatsScope(*this, Pattern);
 
   // Record the point of instantiation.
   if (MemberSpecializationInfo *MSInfo
@@ -8209,6 +8209,47 @@ void ASTReader::PrintStats() {
                  NumIdentifierLookupHits, NumIdentifierLookups,
                  (double)NumIdentifierLookupHits*100.0/NumIdentifierLookups);
 
+  // Break the declarations and types read down by the AST file they came
+  // from, to show how much of each imported module this TU actually needed.
+  if (ModuleMgr.size()) {
+    SmallVector<unsigned, 0> DeclsRead(ModuleMgr.size());
+    SmallVector<unsigned, 0> TypesRead(ModuleMgr.size());
+    // (base index, module file index) pairs for the modules with entries.
+    using BaseAndIndex = std::pair<unsigned, unsigned>;
+    SmallVector<BaseAndIndex, 0> DeclBases, TypeBases;
+    for (ModuleFile &F : ModuleMgr) {
+      if (F.LocalNumDecls)
+        DeclBases.push_back({F.BaseDeclIndex, F.Index});
+      if (F.LocalNumTypes)
+        TypeBases.push_back({F.BaseTypeIndex, F.Index});
+    }
+    llvm::sort(DeclBases);
+    llvm::sort(TypeBases);
+    auto OwnerOf = [](ArrayRef<BaseAndIndex> Bases, size_t Index) {
+      auto It = llvm::upper_bound(
+          Bases, Index,
+          [](size_t I, const BaseAndIndex &B) { return I < B.first; });
+      assert(It != Bases.begin() && "index below the first module base");
+      return std::prev(It)->second;
+    };
+    for (auto I = DeclsLoaded.materialized_begin(),
+              E = DeclsLoaded.materialized_end();
+         I != E; ++I)
+      if (*I)
+        ++DeclsRead[OwnerOf(DeclBases, I.getIndex())];
+    for (auto I = TypesLoaded.materialized_begin(),
+              E = TypesLoaded.materialized_end();
+         I != E; ++I)
+      if (!(*I).isNull())
+        ++TypesRead[OwnerOf(TypeBases, I.getIndex())];
+
+    std::fprintf(stderr, "\n  Per-module statistics:\n");
+    for (ModuleFile &F : ModuleMgr)
+      std::fprintf(stderr, "    %s: %u/%u declarations, %u/%u types read\n",
+                   F.FileName.c_str(), DeclsRead[F.Index], F.LocalNumDecls,
+                   TypesRead[F.Index], F.LocalNumTypes);
+  }
+
   if (GlobalIndex) {
     std::fprintf(stderr, "\n");
     GlobalIndex->printStats();
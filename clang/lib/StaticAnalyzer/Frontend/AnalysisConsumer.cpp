@@ -39,6 +39,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Program.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/Timer.h"
 #include "llvm/Support/raw_ostream.h"
 #include <memory>
@@ -670,6 +671,10 @@ void AnalysisConsumer::HandleCode(Decl *D, AnalysisMode Mode,
   if (Mgr->getAnalysisDeclContext(D)->isBodyAutosynthesized())
     return;
 
+  llvm::TimeTraceScope TimeScope("HandleCode", [&] {
+    return AnalysisDeclContext::getFunctionName(D);
+  });
+
   CFG *DeclCFG = Mgr->getCFG(D);
   if (DeclCFG)
     MaxCFGSize.updateMax(DeclCFG->size());
@@ -726,8 +731,11 @@ void AnalysisConsumer::RunPathSensitiveChecks(Decl *D,
     ExprEngineStartTime = ExprEngineTimer->getTotalTime();
     ExprEngineTimer->startTimer();
   }
-  Eng.ExecuteWorkList(Mgr->getAnalysisDeclContextManager().getStackFrame(D),
-                      Mgr->options.MaxNodesPerTopLevelFunction);
+  {
+    llvm::TimeTraceScope TimeScope("ExecuteWorkList");
+    Eng.ExecuteWorkList(Mgr->getAnalysisDeclContextManager().getStackFrame(D),
+                        Mgr->options.MaxNodesPerTopLevelFunction);
+  }
   if (ExprEngineTimer) {
     ExprEngineTimer->stopTimer();
     llvm::TimeRecord ExprEngineEndTime = ExprEngineTimer->getTotalTime();
@@ -745,6 +753,7 @@ void AnalysisConsumer::RunPathSensitiveChecks(Decl *D,
   // Display warnings.
   if (BugReporterTimer)
     BugReporterTimer->startTimer();
+  llvm::TimeTraceScope TimeScope("FlushReports");
   Eng.getBugReporter().FlushReports();
   if (BugReporterTimer)
     BugReporterTimer->stopTimer();
@@ -64,6 +64,10 @@ public:
     Generator.printDependencies(S);
   }
 
+  std::vector<std::string> takeDependencies() {
+    return std::move(Dependencies);
+  }
+
 protected:
   std::unique_ptr<DependencyOutputOptions> Opts;
   std::vector<std::string> Dependencies;
@@ -71,7 +75,8 @@ protected:
 } // anonymous namespace
 
 llvm::Expected<std::string> DependencyScanningTool::getDependencyFile(
-    const std::vector<std::string> &CommandLine, StringRef CWD) {
+    const std::vector<std::string> &CommandLine, StringRef CWD,
+    std::vector<std::string> *FileDeps) {
   MakeDependencyPrinterConsumer Consumer;
   CallbackActionController Controller(nullptr);
   auto Result =
@@ -80,6 +85,8 @@ llvm::Expected<std::string> DependencyScanningTool::getDependencyFile(
     return std::move(Result);
   std::string Output;
   Consumer.printDependencies(Output);
+  if (FileDeps)
+    *FileDeps = Consumer.takeDependencies();
   return Output;
 }
 
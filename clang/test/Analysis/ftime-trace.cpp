@@ -0,0 +1,16 @@
+// RUN: %clang_analyze_cc1 -analyzer-checker=core %s -ftime-trace=%t.json -ftime-trace-granularity=0 -verify
+// RUN: %python -c 'import json, sys; json.dump(json.loads(sys.stdin.read()), sys.stdout, sort_keys=True, indent=2)' < %t.json \
+// RUN:   | FileCheck %s
+
+// Events are emitted as they end, so the nested scopes come first.
+// CHECK:      "name": "ExecuteWorkList"
+// CHECK:      "name": "FlushReports"
+// CHECK:      "detail": "foo()"
+// CHECK-NEXT: },
+// CHECK-NEXT: "dur":
+// CHECK-NEXT: "name": "HandleCode"
+
+int foo() {
+  int *p = nullptr;
+  return *p; // expected-warning{{Dereference of null pointer}}
+}
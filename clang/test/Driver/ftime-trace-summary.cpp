@@ -0,0 +1,27 @@
+// RUN: rm -rf %t && mkdir -p %t && cd %t
+// RUN: %clangxx -S -no-canonical-prefixes -ftime-trace-summary=summary.json -ftime-trace-granularity=0 -o out %s
+// RUN: cat summary.json \
+// RUN:   | %python -c 'import json, sys; json.dump(json.loads(sys.stdin.read()), sys.stdout, sort_keys=True, indent=2)' \
+// RUN:   | FileCheck %s
+// RUN: not ls out.json
+
+// CHECK:      "beginningOfTime": {{[0-9]{16},}}
+// CHECK-NEXT: "details": [
+// CHECK:      "detail": "Struct<int>"
+// CHECK:      "name": "InstantiateClass"
+// CHECK:      "totals": [
+// CHECK:      "name": "ExecuteCompiler"
+
+// RUN: %clang -### -c -ftime-trace-summary=a.json -ftime-trace-granularity=0 %s 2>&1 | FileCheck %s --check-prefix=DRIVER
+// DRIVER: -cc1{{.*}} "-ftime-trace-summary=a.json" "-ftime-trace-granularity=0"
+
+template <typename T>
+struct Struct {
+  T Num;
+};
+
+int main() {
+  Struct<int> S;
+
+  return 0;
+}
@@ -0,0 +1,14 @@
+// RUN: rm -rf %t
+// RUN: mkdir %t
+// RUN: echo 'int a_used = 0; int a_unused = 1;' > %t/a.h
+// RUN: echo 'module A { header "a.h" }' > %t/m.modulemap
+// RUN: %clang_cc1 -fmodules -emit-module -fmodule-name=A -x c %t/m.modulemap -o %t/a.pcm
+// RUN: %clang_cc1 -fmodules -fmodule-file=A=%t/a.pcm -fmodule-map-file=%t/m.modulemap \
+// RUN:   -fsyntax-only -print-stats %s 2>&1 | FileCheck %s
+
+#include "a.h"
+
+int use(void) { return a_used; }
+
+// CHECK: Per-module statistics:
+// CHECK-NEXT: a.pcm: {{[0-9]+}}/{{[0-9]+}} declarations, {{[0-9]+}}/{{[0-9]+}} types read
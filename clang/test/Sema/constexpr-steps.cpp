@@ -0,0 +1,14 @@
+// RUN: %clang_cc1 -std=c++14 -fsyntax-only -fconstexpr-steps=100 -verify %s
+// RUN: %clang_cc1 -std=c++14 -fsyntax-only -fconstexpr-steps=100 -verify %s -fexperimental-new-constant-interpreter
+
+constexpr int count(int N) {
+  int I = 0;
+  while (I < N)
+    ++I;
+  return I;
+}
+
+static_assert(count(10) == 10, "");
+static_assert(count(1000) == 1000, ""); // expected-error {{not an integral constant expression}} \
+                                        // expected-note {{in call to 'count(1000)'}}
+// expected-note@* {{constexpr evaluation hit maximum step limit; possible infinite loop?}}
@@ -0,0 +1,17 @@
+// RUN: %clang_cc1 -fsyntax-only -print-stats %s 2>&1 | FileCheck %s
+
+template <typename T> struct Box {
+  T Value;
+  T get() const { return Value; }
+};
+
+int f() {
+  Box<int> I{1};
+  Box<char> C{2};
+  return I.get() + C.get();
+}
+
+// CHECK: *** Semantic Analysis Stats:
+// CHECK: 4 template instantiations of 2 patterns.
+// CHECK-DAG: 2 instantiations, depth   1: Box{{$}}
+// CHECK-DAG: 2 instantiations, depth   1: Box::get{{$}}
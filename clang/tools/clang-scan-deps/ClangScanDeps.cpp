@@ -16,17 +16,21 @@
 #include "clang/Tooling/DependencyScanning/DependencyScanningWorker.h"
 #include "clang/Tooling/JSONCompilationDatabase.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileUtilities.h"
 #include "llvm/Support/Format.h"
 #include "llvm/Support/JSON.h"
 #include "llvm/Support/LLVMDriver.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Support/Program.h"
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/Threading.h"
 #include "llvm/Support/Timer.h"
+#include "llvm/Support/xxhash.h"
 #include "llvm/TargetParser/Host.h"
 #include <mutex>
 #include <optional>
@@ -84,6 +88,7 @@ static std::string ModuleName;
 static std::vector<std::string> ModuleDepTargets;
 static bool DeprecatedDriverCommand;
 static ResourceDirRecipeKind ResourceDirRecipe;
+static std::string MakeCacheDir;
 static bool Verbose;
 static bool PrintTiming;
 static llvm::BumpPtrAllocator Alloc;
@@ -217,6 +222,9 @@ static void ParseArgs(int argc, char **argv) {
     ResourceDirRecipe = *Kind;
   }
 
+  if (const llvm::opt::Arg *A = Args.getLastArg(OPT_make_cache_dir_EQ))
+    MakeCacheDir = A->getValue();
+
   PrintTiming = Args.hasArg(OPT_print_timing);
 
   Verbose = Args.hasArg(OPT_verbose);
@@ -306,6 +314,112 @@ private:
 
 } // end anonymous namespace
 
+namespace {
+/// A persistent cache of make-format scan results, with one JSON file per
+/// translation unit in -make-cache-dir. An entry is reused if the working
+/// directory and command line are unchanged and no recorded dependency has
+/// changed size or modification time. A newly added header that would shadow
+/// a recorded one is not detected.
+class MakeResultCache {
+public:
+  MakeResultCache(StringRef CacheDir, StringRef CWD,
+                  const std::vector<std::string> &CommandLine)
+      : CWD(CWD) {
+    Key.push_back(std::string(CWD));
+    std::string KeyString(CWD);
+    for (const std::string &Arg : CommandLine) {
+      Key.push_back(Arg);
+      KeyString += '\0';
+      KeyString += Arg;
+    }
+    llvm::SmallString<256> Path(CacheDir);
+    llvm::sys::path::append(
+        Path, llvm::utohexstr(llvm::xxh3_64bits(KeyString), /*LowerCase=*/true,
+                              /*Width=*/16) +
+                  ".json");
+    EntryPath = std::string(Path);
+  }
+
+  /// Return the cached dependency file if the entry is still valid.
+  std::optional<std::string> lookup() const {
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> Buffer =
+        llvm::MemoryBuffer::getFile(EntryPath);
+    if (!Buffer)
+      return std::nullopt;
+    llvm::Expected<llvm::json::Value> Entry =
+        llvm::json::parse((*Buffer)->getBuffer());
+    if (!Entry) {
+      llvm::consumeError(Entry.takeError());
+      return std::nullopt;
+    }
+    const llvm::json::Object *Obj = Entry->getAsObject();
+    if (!Obj)
+      return std::nullopt;
+    const llvm::json::Array *EntryKey = Obj->getArray("key");
+    const llvm::json::Array *Deps = Obj->getArray("deps");
+    std::optional<StringRef> Output = Obj->getString("output");
+    if (!EntryKey || *EntryKey != Key || !Deps || !Output)
+      return std::nullopt;
+    for (const llvm::json::Value &Dep : *Deps) {
+      const llvm::json::Object *DepObj = Dep.getAsObject();
+      if (!DepObj)
+        return std::nullopt;
+      std::optional<StringRef> File = DepObj->getString("file");
+      std::optional<int64_t> MTime = DepObj->getInteger("mtime");
+      std::optional<int64_t> Size = DepObj->getInteger("size");
+      if (!File || !MTime || !Size)
+        return std::nullopt;
+      std::optional<std::pair<int64_t, int64_t>> Current = stat(*File);
+      if (!Current || Current->first != *MTime || Current->second != *Size)
+        return std::nullopt;
+    }
+    return Output->str();
+  }
+
+  /// Record \p Output together with the current state of \p FileDeps.
+  void store(StringRef Output, ArrayRef<std::string> FileDeps) const {
+    llvm::json::Array Deps;
+    for (const std::string &File : FileDeps) {
+      std::optional<std::pair<int64_t, int64_t>> Current = stat(File);
+      // Don't cache a result we won't be able to validate.
+      if (!Current)
+        return;
+      Deps.push_back(llvm::json::Object{{"file", File},
+                                        {"mtime", Current->first},
+                                        {"size", Current->second}});
+    }
+    llvm::json::Object Entry{{"key", Key},
+                             {"deps", std::move(Deps)},
+                             {"output", Output}};
+    // Failing to write the cache only costs a rescan next time.
+    llvm::consumeError(
+        llvm::writeToOutput(EntryPath, [&](llvm::raw_ostream &OS) {
+          OS << llvm::json::Value(std::move(Entry));
+          return llvm::Error::success();
+        }));
+  }
+
+private:
+  /// Return the modification time and size of \p File, relative to the
+  /// working directory of the command.
+  std::optional<std::pair<int64_t, int64_t>> stat(StringRef File) const {
+    llvm::SmallString<256> Path(File);
+    llvm::sys::fs::make_absolute(CWD, Path);
+    llvm::sys::fs::file_status Status;
+    if (llvm::sys::fs::status(Path, Status))
+      return std::nullopt;
+    return std::make_pair(
+        static_cast<int64_t>(
+            Status.getLastModificationTime().time_since_epoch().count()),
+        static_cast<int64_t>(Status.getSize()));
+  }
+
+  std::string CWD;
+  llvm::json::Array Key;
+  std::string EntryPath;
+};
+} // end anonymous namespace
+
 /// Takes the result of a dependency scan and prints error / dependency files
 /// based on the result.
 ///
@@ -900,6 +1014,7 @@ int clang_scan_deps_main(int argc, char **argv, const llvm::ToolContext &) {
       AdjustingCompilations->getAllCompileCommands();
 
   std::atomic<bool> HadErrors(false);
+  std::atomic<size_t> NumMakeCacheHits(0);
   std::optional<FullDeps> FD;
   P1689Deps PD;
 
@@ -938,7 +1053,20 @@ int clang_scan_deps_main(int argc, char **argv, const llvm::ToolContext &) {
 
       // Run the tool on it.
       if (Format == ScanningOutputFormat::Make) {
-        auto MaybeFile = WorkerTool.getDependencyFile(Input->CommandLine, CWD);
+        std::optional<MakeResultCache> Cache;
+        if (!MakeCacheDir.empty()) {
+          Cache.emplace(MakeCacheDir, CWD, Input->CommandLine);
+          if (std::optional<std::string> Cached = Cache->lookup()) {
+            ++NumMakeCacheHits;
+            DependencyOS.applyLocked([&](raw_ostream &OS) { OS << *Cached; });
+            continue;
+          }
+        }
+        std::vector<std::string> FileDeps;
+        auto MaybeFile = WorkerTool.getDependencyFile(
+            Input->CommandLine, CWD, Cache ? &FileDeps : nullptr);
+        if (MaybeFile && Cache)
+          Cache->store(*MaybeFile, FileDeps);
         if (handleMakeDependencyToolResult(Filename, MaybeFile, DependencyOS,
                                            Errs))
           HadErrors = true;
@@ -1001,6 +1129,14 @@ int clang_scan_deps_main(int argc, char **argv, const llvm::ToolContext &) {
     }
   };
 
+  if (!MakeCacheDir.empty()) {
+    if (std::error_code EC = llvm::sys::fs::create_directories(MakeCacheDir)) {
+      llvm::errs() << "Failed to create make cache directory '"
+                   << MakeCacheDir << "': " << EC.message() << '\n';
+      return 1;
+    }
+  }
+
   DependencyScanningService Service(ScanMode, Format, OptimizeArgs,
                                     EagerLoadModules);
 
@@ -1025,6 +1161,9 @@ int clang_scan_deps_main(int argc, char **argv, const llvm::ToolContext &) {
   }
 
   T.stopTimer();
+  if (Verbose && !MakeCacheDir.empty())
+    llvm::outs() << "Reused cached results for " << NumMakeCacheHits << " of "
+                 << Inputs.size() << " files\n";
   if (PrintTiming)
     llvm::errs() << llvm::format(
         "clang-scan-deps timing: %0.2fs wall, %0.2fs process\n",
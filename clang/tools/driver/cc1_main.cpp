@@ -192,7 +192,10 @@ int cc1_main(ArrayRef<const char *> Argv, const char *Argv0, void *MainAddr) {
   bool Success = CompilerInvocation::CreateFromArgs(Clang->getInvocation(),
                                                     Argv, Diags, Argv0);
 
-  if (!Clang->getFrontendOpts().TimeTracePath.empty()) {
+  if (!Clang->getFrontendOpts().TimeTracePath.empty() ||
+      !Clang->getFrontendOpts().TimeTraceSummaryPath.empty()) {
+    llvm::timeTraceProfilerSetDetailSummary(
+        !Clang->getFrontendOpts().TimeTraceSummaryPath.empty());
     llvm::timeTraceProfilerInitialize(
         Clang->getFrontendOpts().TimeTraceGranularity, Argv0);
   }
@@ -250,15 +253,28 @@ int cc1_main(ArrayRef<const char *> Argv, const char *Argv0, void *MainAddr) {
       Clang->createFileManager(createVFSFromCompilerInvocation(
           Clang->getInvocation(), Clang->getDiagnostics()));
 
-    if (auto profilerOutput = Clang->createOutputFile(
-            Clang->getFrontendOpts().TimeTracePath, /*Binary=*/false,
-            /*RemoveFileOnSignal=*/false,
-            /*useTemporary=*/false)) {
-      llvm::timeTraceProfilerWrite(*profilerOutput);
-      profilerOutput.reset();
-      llvm::timeTraceProfilerCleanup();
-      Clang->clearOutputFiles(false);
+    const FrontendOptions &FEOpts = Clang->getFrontendOpts();
+    if (!FEOpts.TimeTracePath.empty()) {
+      if (auto profilerOutput = Clang->createOutputFile(
+              FEOpts.TimeTracePath, /*Binary=*/false,
+              /*RemoveFileOnSignal=*/false,
+              /*useTemporary=*/false)) {
+        llvm::timeTraceProfilerWrite(*profilerOutput);
+        profilerOutput.reset();
+        Clang->clearOutputFiles(false);
+      }
     }
+    if (!FEOpts.TimeTraceSummaryPath.empty()) {
+      if (auto summaryOutput = Clang->createOutputFile(
+              FEOpts.TimeTraceSummaryPath, /*Binary=*/false,
+              /*RemoveFileOnSignal=*/false,
+              /*useTemporary=*/false)) {
+        llvm::timeTraceProfilerWriteSummary(*summaryOutput);
+        summaryOutput.reset();
+        Clang->clearOutputFiles(false);
+      }
+    }
+    llvm::timeTraceProfilerCleanup();
   }
 
   // Our error handler depends on the Diagnostics object, which we're
@@ -346,23 +346,27 @@ void GuardedPoolAllocator::deallocate(void *Ptr) {
     return;
   }
 
-  // Intentionally scope the mutex here, so that other threads can access the
-  // pool during the expensive markInaccessible() call.
-  {
-    ScopedLock L(PoolMutex);
-
-    // Ensure that the deallocation is recorded before marking the page as
-    // inaccessible. Otherwise, a racy use-after-free will have inconsistent
-    // metadata.
+  // The slot is not returned to the pool until the very end, so recording the
+  // deallocation only needs to be serialized against the crash handler, which
+  // takes both locks through disable(). Don't hold the pool mutex while
+  // collecting the backtrace, as it can be expensive and other threads would
+  // not be able to allocate or free in the meantime.
+  //
+  // Ensure that the deallocation is recorded before marking the page as
+  // inaccessible. Otherwise, a racy use-after-free will have inconsistent
+  // metadata.
+  if (!getThreadLocals()->RecursiveGuard) {
+    ScopedLock UL(BacktraceMutex);
     Meta->RecordDeallocation();
-
     // Ensure that the unwinder is not called if the recursive flag is set,
     // otherwise non-reentrant unwinders may deadlock.
-    if (!getThreadLocals()->RecursiveGuard) {
-      ScopedRecursiveGuard SRG;
-      ScopedLock UL(BacktraceMutex);
-      Meta->DeallocationTrace.RecordBacktrace(Backtrace);
-    }
+    ScopedRecursiveGuard SRG;
+    Meta->DeallocationTrace.RecordBacktrace(Backtrace);
+  } else {
+    // This free may come from an unwinder that allocate() or deallocate()
+    // called with BacktraceMutex held, so take the pool mutex instead.
+    ScopedLock L(PoolMutex);
+    Meta->RecordDeallocation();
   }
 
   deallocateInGuardedPool(reinterpret_cast<void *>(SlotStart),
@@ -0,0 +1,67 @@
+//===-- unwinder_free.cpp ---------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "gwp_asan/guarded_pool_allocator.h"
+#include "gwp_asan/options.h"
+#include "gwp_asan/tests/harness.h"
+
+// Unwinders may free memory, for example to release a cache of unwind info.
+// If that memory came from GWP-ASan, the deallocation happens while the
+// allocator is recording a backtrace, and must not deadlock.
+static gwp_asan::GuardedPoolAllocator *UnwinderGPA;
+static void *UnwinderPtrToFree;
+
+static size_t FreeingBacktrace(uintptr_t *TraceBuffer, size_t Size) {
+  if (void *Ptr = UnwinderPtrToFree) {
+    UnwinderPtrToFree = nullptr;
+    UnwinderGPA->deallocate(Ptr);
+  }
+  if (Size == 0)
+    return 0;
+  TraceBuffer[0] = 1u;
+  return 1u;
+}
+
+class UnwinderFreeTest : public ::testing::Test {
+public:
+  void SetUp() override {
+    gwp_asan::options::Options Opts;
+    Opts.setDefaults();
+    Opts.MaxSimultaneousAllocations = 4;
+    Opts.Backtrace = FreeingBacktrace;
+    GPA.init(Opts);
+    UnwinderGPA = &GPA;
+  }
+
+  void TearDown() override {
+    UnwinderPtrToFree = nullptr;
+    UnwinderGPA = nullptr;
+    GPA.uninitTestOnly();
+  }
+
+protected:
+  gwp_asan::GuardedPoolAllocator GPA;
+};
+
+TEST_F(UnwinderFreeTest, FreeWhileUnwindingAllocation) {
+  UnwinderPtrToFree = GPA.allocate(1);
+  ASSERT_NE(nullptr, UnwinderPtrToFree);
+  void *Ptr = GPA.allocate(1);
+  ASSERT_NE(nullptr, Ptr);
+  EXPECT_EQ(nullptr, UnwinderPtrToFree);
+  GPA.deallocate(Ptr);
+}
+
+TEST_F(UnwinderFreeTest, FreeWhileUnwindingDeallocation) {
+  void *Ptr = GPA.allocate(1);
+  ASSERT_NE(nullptr, Ptr);
+  UnwinderPtrToFree = GPA.allocate(1);
+  ASSERT_NE(nullptr, UnwinderPtrToFree);
+  GPA.deallocate(Ptr);
+  EXPECT_EQ(nullptr, UnwinderPtrToFree);
+}
@@ -37,6 +37,18 @@ COMPILER_RT_VISIBILITY void __llvm_profile_set_dumped(void) {
   lprofSetProfileDumped(1);
 }
 
+/* Read by code lowered with -sampled-instrumentation before every counter
+ * update. */
+COMPILER_RT_VISIBILITY uint8_t __llvm_profile_sampling = 1;
+
+COMPILER_RT_VISIBILITY void __llvm_profile_set_sampling(int Enable) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  *(volatile uint8_t *)&__llvm_profile_sampling = Enable != 0;
+#else
+  __atomic_store_n(&__llvm_profile_sampling, Enable != 0, __ATOMIC_RELAXED);
+#endif
+}
+
 /* Return the number of bytes needed to add to SizeInBytes to make it
  *   the result a multiple of 8.
  */
@@ -296,6 +296,17 @@ int __llvm_profile_get_padding_sizes_for_counters(
  */
 void __llvm_profile_set_dumped();
 
+/*!
+ * \brief Enable or disable counter updates in sampled instrumentation.
+ *
+ * Code lowered with -mllvm -sampled-instrumentation only updates its counters
+ * while sampling is enabled, which is the default. Toggling this periodically
+ * limits the instrumentation overhead to the sampling windows. The flag is
+ * shared by all threads of the module. MC/DC test vector bitmap updates are
+ * not guarded by it.
+ */
+void __llvm_profile_set_sampling(int Enable);
+
 /*!
  * This variable is defined in InstrProfilingRuntime.cpp as a hidden
  * symbol. Its main purpose is to enable profile runtime user to
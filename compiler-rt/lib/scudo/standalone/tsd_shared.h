@@ -224,7 +224,11 @@ private:
       Inc = CoPrimes[R % NumberOfCoPrimes];
     }
     if (N > 1U) {
-      u32 Index = R % N;
+      // Start with the context matching the current CPU if it is known. Threads
+      // that run on the same CPU then tend to share a context, which keeps its
+      // cache warm and rarely contended.
+      const s32 CPU = getCurrentCPU();
+      u32 Index = (CPU >= 0 ? static_cast<u32>(CPU) : R) % N;
       uptr LowestPrecedence = UINTPTR_MAX;
       TSD<Allocator> *CandidateTSD = nullptr;
       // Go randomly through at most 4 contexts and find a candidate.
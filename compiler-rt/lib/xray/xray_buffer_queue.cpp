@@ -188,9 +188,9 @@ BufferQueue::ErrorCode BufferQueue::releaseBuffer(Buffer &Buf) {
   {
     SpinMutexLock Guard(&Mutex);
     if (Buf.Generation != generation() || LiveBuffers == 0) {
-      Buf = {};
       decRefCount(Buf.BackingStore, Buf.Size, Buf.Count);
       decRefCount(Buf.ExtentsBackingStore, kExtentsSize, Buf.Count);
+      Buf = {};
       return BufferQueue::ErrorCode::Ok;
     }
 
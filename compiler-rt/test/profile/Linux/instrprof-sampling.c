@@ -0,0 +1,21 @@
+// REQUIRES: linux
+// RUN: %clang_profgen -mllvm -sampled-instrumentation -o %t %s
+// RUN: env LLVM_PROFILE_FILE=%t.profraw %run %t
+// RUN: llvm-profdata merge -o %t.profdata %t.profraw
+// RUN: llvm-profdata show --counts --function=sampled %t.profdata | FileCheck %s
+
+void __llvm_profile_set_sampling(int Enable);
+
+__attribute__((noinline)) void sampled(void) {}
+
+int main(void) {
+  for (int I = 0; I < 3; ++I)
+    sampled();
+  __llvm_profile_set_sampling(0);
+  for (int I = 0; I < 5; ++I)
+    sampled();
+  __llvm_profile_set_sampling(1);
+  return 0;
+}
+
+// CHECK: Function count: 3
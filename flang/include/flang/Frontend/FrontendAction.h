@@ -19,6 +19,7 @@
 #define FORTRAN_FRONTEND_FRONTENDACTION_H
 
 #include "flang/Frontend/FrontendOptions.h"
+#include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Error.h"
 
 namespace Fortran::frontend {
@@ -107,6 +108,12 @@ public:
 
   /// @}
 protected:
+  // The timer group that the frontend phases are reported in with
+  // -ftime-report.
+  static constexpr llvm::StringLiteral timerGroupName = "flang";
+  static constexpr llvm::StringLiteral timerGroupDescription =
+      "Flang frontend phases";
+
   // Prescan the current input file. Return False if fatal errors are reported,
   // True otherwise.
   bool runPrescan();
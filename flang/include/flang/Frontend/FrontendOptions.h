@@ -236,7 +236,8 @@ public:
 struct FrontendOptions {
   FrontendOptions()
       : showHelp(false), showVersion(false), instrumentedParse(false),
-        showColors(false), needProvenanceRangeToCharBlockMappings(false) {}
+        showColors(false), needProvenanceRangeToCharBlockMappings(false),
+        timeReport(false) {}
 
   /// Show the -help text.
   unsigned showHelp : 1;
@@ -255,6 +256,9 @@ struct FrontendOptions {
   /// compilation.
   unsigned needProvenanceRangeToCharBlockMappings : 1;
 
+  /// Report the time spent in each frontend phase (-ftime-report).
+  unsigned timeReport : 1;
+
   /// Input values from `-fget-definition`
   struct GetDefinitionVals {
     unsigned line;
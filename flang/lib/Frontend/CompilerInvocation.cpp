@@ -578,6 +578,7 @@ static bool parseFrontendArgs(FrontendOptions &opts, llvm::opt::ArgList &args,
   opts.outputFile = args.getLastArgValue(clang::driver::options::OPT_o);
   opts.showHelp = args.hasArg(clang::driver::options::OPT_help);
   opts.showVersion = args.hasArg(clang::driver::options::OPT_version);
+  opts.timeReport = args.hasArg(clang::driver::options::OPT_ftime_report);
 
   // Get the input kind (from the value passed via `-x`)
   InputKind dashX(Language::Unknown);
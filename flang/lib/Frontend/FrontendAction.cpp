@@ -17,6 +17,7 @@
 #include "flang/Frontend/FrontendPluginRegistry.h"
 #include "clang/Basic/DiagnosticFrontend.h"
 #include "llvm/Support/Errc.h"
+#include "llvm/Support/Timer.h"
 #include "llvm/Support/VirtualFileSystem.h"
 
 using namespace Fortran::frontend;
@@ -148,7 +149,12 @@ bool FrontendAction::runPrescan() {
   }
 
   // Prescan. In case of failure, report and return.
-  ci.getParsing().Prescan(currentInputPath, parserOptions);
+  {
+    llvm::NamedRegionTimer timer(
+        "prescan", "Prescanning", timerGroupName, timerGroupDescription,
+        ci.getInvocation().getFrontendOpts().timeReport);
+    ci.getParsing().Prescan(currentInputPath, parserOptions);
+  }
 
   return !reportFatalScanningErrors();
 }
@@ -157,7 +163,12 @@ bool FrontendAction::runParse(bool emitMessages) {
   CompilerInstance &ci = this->getInstance();
 
   // Parse. In case of failure, report and return.
-  ci.getParsing().Parse(llvm::outs());
+  {
+    llvm::NamedRegionTimer timer(
+        "parse", "Parsing", timerGroupName, timerGroupDescription,
+        ci.getInvocation().getFrontendOpts().timeReport);
+    ci.getParsing().Parse(llvm::outs());
+  }
 
   if (reportFatalParsingErrors()) {
     return false;
@@ -187,7 +198,12 @@ bool FrontendAction::runSemanticChecks() {
   auto &semantics = ci.getSemantics();
 
   // Run semantic checks
-  semantics.Perform();
+  {
+    llvm::NamedRegionTimer timer(
+        "semantics", "Semantic analysis", timerGroupName,
+        timerGroupDescription, ci.getInvocation().getFrontendOpts().timeReport);
+    semantics.Perform();
+  }
 
   if (reportFatalSemanticErrors()) {
     return false;
@@ -68,6 +68,7 @@
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/Timer.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/TargetParser/RISCVISAInfo.h"
@@ -312,7 +313,12 @@ bool CodeGenAction::beginSourceFileAction() {
 
   // Create a parse tree and lower it to FIR
   Fortran::parser::Program &parseTree{*ci.getParsing().parseTree()};
-  lb.lower(parseTree, ci.getSemanticsContext());
+  {
+    llvm::NamedRegionTimer timer(
+        "lower", "Lowering to FIR", timerGroupName, timerGroupDescription,
+        ci.getInvocation().getFrontendOpts().timeReport);
+    lb.lower(parseTree, ci.getSemanticsContext());
+  }
 
   // Add target specific items like dependent libraries, target specific
   // constants etc.
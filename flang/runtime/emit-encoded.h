@@ -15,6 +15,8 @@
 #include "environment.h"
 #include "tools.h"
 #include "utf.h"
+#include <algorithm>
+#include <cstring>
 
 namespace Fortran::runtime::io {
 
@@ -94,21 +96,32 @@ RT_API_ATTRS bool EmitRepeated(CONTEXT &to, char ch, std::size_t n) {
   if (n <= 0) {
     return true;
   }
+  // Emit in chunks rather than one character at a time; field padding can be
+  // wide, and every Emit() call goes through the statement and unit layers.
+  char buffer[64];
+  std::size_t chunk{n < sizeof buffer ? n : sizeof buffer};
+  std::memset(buffer, ch, chunk);
   ConnectionState &connection{to.GetConnectionState()};
-  if (connection.internalIoCharKind <= 1 &&
-      connection.access != Access::Stream) {
-    // faster path, no encoding needed
-    while (n-- > 0) {
-      if (!to.Emit(&ch, 1)) {
-        return false;
-      }
+  bool noEncoding{connection.internalIoCharKind <= 1 &&
+      connection.access != Access::Stream};
+  while (n > 0) {
+    std::size_t bytes{n < chunk ? n : chunk};
+    if (connection.openRecl) {
+      // A fixed-length record rejects an Emit() that would overrun it as a
+      // whole, so stay within the record and let the overrun, if any, happen
+      // one character at a time, as it would without chunking.
+      std::size_t space{connection.RemainingSpaceInRecord()};
+      bytes = std::min(bytes, space > 0 ? space : std::size_t{1});
     }
-  } else {
-    while (n-- > 0) {
-      if (!EmitEncoded(to, &ch, 1)) {
+    if (noEncoding) {
+      // faster path, no encoding needed
+      if (!to.Emit(buffer, bytes)) {
         return false;
       }
+    } else if (!EmitEncoded(to, buffer, bytes)) {
+      return false;
     }
+    n -= bytes;
   }
   return true;
 }
@@ -77,6 +77,17 @@ private:
 //    DO 2 J = 1, NCOLS
 //     DO 2 I = 1, NROWS
 //   2  RES(I,J) = RES(I,J) + X(I,K)*Y(K,J) ! loop-invariant last term
+// For large matrices, sweeping all of RES once per K thrashes the cache, so
+// the K loop is blocked to keep a panel of X columns resident while each
+// column of RES is accumulated; every element still sums its terms in
+// order of increasing K:
+//   DO 2 K0 = 1, N, KBLOCK
+//    DO 2 J = 1, NCOLS
+//     DO 2 K = K0, MIN(N, K0 + KBLOCK - 1)
+//      DO 2 I = 1, NROWS
+//   2   RES(I,J) = RES(I,J) + X(I,K)*Y(K,J)
+static constexpr RT_CONST_VAR_ATTRS std::size_t matmulPanelBytes{256 * 1024};
+
 template <TypeCategory RCAT, int RKIND, typename XT, typename YT,
     bool X_HAS_STRIDED_COLUMNS, bool Y_HAS_STRIDED_COLUMNS>
 inline RT_API_ATTRS void MatrixTimesMatrix(
@@ -86,28 +97,38 @@ inline RT_API_ATTRS void MatrixTimesMatrix(
     std::size_t yColumnByteStride = 0) {
   using ResultType = CppTypeFor<RCAT, RKIND>;
   std::memset(product, 0, rows * cols * sizeof *product);
-  const XT *RESTRICT xp0{x};
-  for (SubscriptValue k{0}; k < n; ++k) {
+  if (rows <= 0) {
+    return;
+  }
+  SubscriptValue kBlock{static_cast<SubscriptValue>(
+      matmulPanelBytes / (static_cast<std::size_t>(rows) * sizeof *x))};
+  if (kBlock < 1) {
+    kBlock = 1;
+  }
+  for (SubscriptValue k0{0}; k0 < n; k0 += kBlock) {
+    SubscriptValue kEnd{n - k0 > kBlock ? k0 + kBlock : n};
     ResultType *RESTRICT p{product};
-    for (SubscriptValue j{0}; j < cols; ++j) {
-      const XT *RESTRICT xp{xp0};
-      ResultType yv;
-      if constexpr (!Y_HAS_STRIDED_COLUMNS) {
-        yv = static_cast<ResultType>(y[k + j * n]);
-      } else {
-        yv = static_cast<ResultType>(reinterpret_cast<const YT *>(
-            reinterpret_cast<const char *>(y) + j * yColumnByteStride)[k]);
-      }
-      for (SubscriptValue i{0}; i < rows; ++i) {
-        *p++ += static_cast<ResultType>(*xp++) * yv;
+    for (SubscriptValue j{0}; j < cols; ++j, p += rows) {
+      for (SubscriptValue k{k0}; k < kEnd; ++k) {
+        const XT *RESTRICT xp;
+        if constexpr (!X_HAS_STRIDED_COLUMNS) {
+          xp = x + k * rows;
+        } else {
+          xp = reinterpret_cast<const XT *>(
+              reinterpret_cast<const char *>(x) + k * xColumnByteStride);
+        }
+        ResultType yv;
+        if constexpr (!Y_HAS_STRIDED_COLUMNS) {
+          yv = static_cast<ResultType>(y[k + j * n]);
+        } else {
+          yv = static_cast<ResultType>(reinterpret_cast<const YT *>(
+              reinterpret_cast<const char *>(y) + j * yColumnByteStride)[k]);
+        }
+        for (SubscriptValue i{0}; i < rows; ++i) {
+          p[i] += static_cast<ResultType>(xp[i]) * yv;
+        }
       }
     }
-    if constexpr (!X_HAS_STRIDED_COLUMNS) {
-      xp0 += rows;
-    } else {
-      xp0 = reinterpret_cast<const XT *>(
-          reinterpret_cast<const char *>(xp0) + xColumnByteStride);
-    }
   }
 }
 
@@ -25,6 +25,7 @@
 #include "llvm/Option/ArgList.h"
 #include "llvm/Option/OptTable.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/Timer.h"
 
 #include <cstdio>
 
@@ -66,6 +67,13 @@ int fc1_main(llvm::ArrayRef<const char *> argv, const char *argv0) {
   // Execute the frontend actions.
   success = executeCompilerInvocation(flang.get());
 
+  // Print the -ftime-report timings now rather than at exit, so that they
+  // are not lost if the process is terminated without running destructors.
+  if (flang->getInvocation().getFrontendOpts().timeReport) {
+    llvm::TimerGroup::printAll(llvm::errs());
+    llvm::TimerGroup::clearAll();
+  }
+
   // Delete output files to free Compiler Instance
   flang->clearOutputFiles(/*EraseFiles=*/false);
 
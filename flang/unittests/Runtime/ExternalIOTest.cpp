@@ -382,6 +382,50 @@ TEST(ExternalIOTests, TestDirectFormatted) {
       << "EndIoStatement() for Close";
 }
 
+TEST(ExternalIOTests, TestDirectFormattedOverrun) {
+  // OPEN(NEWUNIT=unit,ACCESS='DIRECT',ACTION='READWRITE',&
+  //   FORM='FORMATTED',RECL=8,STATUS='SCRATCH')
+  auto *io{IONAME(BeginOpenNewUnit)(__FILE__, __LINE__)};
+  ASSERT_TRUE(IONAME(SetAccess)(io, "DIRECT", 6)) << "SetAccess(DIRECT)";
+  ASSERT_TRUE(IONAME(SetAction)(io, "READWRITE", 9)) << "SetAction(READWRITE)";
+  ASSERT_TRUE(IONAME(SetForm)(io, "FORMATTED", 9)) << "SetForm(FORMATTED)";
+
+  static constexpr std::size_t recl{8};
+  ASSERT_TRUE(IONAME(SetRecl)(io, recl)) << "SetRecl()";
+  ASSERT_TRUE(IONAME(SetStatus)(io, "SCRATCH", 7)) << "SetStatus(SCRATCH)";
+
+  int unit{-1};
+  ASSERT_TRUE(IONAME(GetNewUnit)(io, unit)) << "GetNewUnit()";
+  ASSERT_EQ(IONAME(EndIoStatement)(io), IostatOk)
+      << "EndIoStatement() for OpenNewUnit";
+
+  // WRITE(UNIT=unit,FMT=fmt,REC=1,IOSTAT=iostat,IOMSG=iomsg) 1
+  // The leading blanks of the I20 field fill the record and then overrun it
+  // on the first character past its end, as character-by-character output
+  // would.
+  static const char fmt[]{"(I20)"};
+  io = IONAME(BeginExternalFormattedOutput)(
+      fmt, sizeof fmt - 1, nullptr, unit, __FILE__, __LINE__);
+  IONAME(EnableHandlers)(io, true, false, false, false, true);
+  ASSERT_TRUE(IONAME(SetRec)(io, 1)) << "SetRec(1)";
+  ASSERT_FALSE(IONAME(OutputInteger64)(io, 1)) << "OutputInteger64()";
+  char iomsg[128];
+  std::memset(iomsg, '\0', sizeof iomsg);
+  IONAME(GetIoMsg)(io, iomsg, sizeof iomsg - 1);
+  ASSERT_EQ(IONAME(EndIoStatement)(io), IostatRecordWriteOverrun)
+      << "EndIoStatement() for OutputInteger64";
+  ASSERT_NE(std::string_view{iomsg}.find(
+                "Attempt to write 1 bytes to position 8"),
+      std::string_view::npos)
+      << "iomsg '" << iomsg << "'";
+
+  // CLOSE(UNIT=unit,STATUS='DELETE')
+  io = IONAME(BeginClose)(unit, __FILE__, __LINE__);
+  ASSERT_TRUE(IONAME(SetStatus)(io, "DELETE", 6)) << "SetStatus(DELETE)";
+  ASSERT_EQ(IONAME(EndIoStatement)(io), IostatOk)
+      << "EndIoStatement() for Close";
+}
+
 TEST(ExternalIOTests, TestSequentialVariableFormatted) {
   // OPEN(NEWUNIT=unit,ACCESS='SEQUENTIAL',ACTION='READWRITE',&
   //   FORM='FORMATTED',STATUS='SCRATCH')
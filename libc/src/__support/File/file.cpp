@@ -11,6 +11,7 @@
 #include "src/__support/CPP/new.h"
 #include "src/__support/CPP/span.h"
 #include "src/errno/libc_errno.h" // For error macros
+#include "src/string/memory_utils/inline_memcpy.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -61,8 +62,9 @@ FileIOResult File::write_unlocked_fbf(const uint8_t *data, size_t len) {
   const size_t init_pos = pos;
   const size_t bufspace = bufsize - pos;
 
-  // If data is too large to be buffered at all, then just write it unbuffered.
-  if (len > bufspace + bufsize)
+  // If data would fill up the buffer on its own, buffering it only costs a
+  // copy: flush what is pending and write |data| directly instead.
+  if (len > bufspace && len >= bufsize)
     return write_unlocked_nbf(data, len);
 
   // we split |data| (conceptually) using the split point. Then we handle the
@@ -84,9 +86,7 @@ FileIOResult File::write_unlocked_fbf(const uint8_t *data, size_t len) {
   cpp::span<uint8_t> bufref(static_cast<uint8_t *>(buf), bufsize);
 
   // Copy the first piece into the buffer.
-  // TODO: Replace the for loop below with a call to internal memcpy.
-  for (size_t i = 0; i < primary.size(); ++i)
-    bufref[pos + i] = primary[i];
+  inline_memcpy(bufref.data() + pos, primary.data(), primary.size());
   pos += primary.size();
 
   // If there is no remainder, we can return early, since the first piece has
@@ -110,26 +110,10 @@ FileIOResult File::write_unlocked_fbf(const uint8_t *data, size_t len) {
             buf_result.error};
   }
 
-  // The second piece is handled basically the same as the first, although we
-  // know that if the second piece has data in it then the buffer has been
-  // flushed, meaning that pos is always 0.
-  if (remainder.size() < bufsize) {
-    // TODO: Replace the for loop below with a call to internal memcpy.
-    for (size_t i = 0; i < remainder.size(); ++i)
-      bufref[i] = remainder[i];
-    pos = remainder.size();
-  } else {
-
-    auto result = platform_write(this, remainder.data(), remainder.size());
-    size_t bytes_written = buf_result.value;
-
-    // If less bytes were written than expected, then an error occurred. Return
-    // the number of bytes that have been written from |data|.
-    if (result.has_error() || bytes_written < remainder.size()) {
-      err = true;
-      return {primary.size() + bytes_written, result.error};
-    }
-  }
+  // Since |data| was not large enough to bypass the buffer, the remainder
+  // always fits into the now empty buffer.
+  inline_memcpy(bufref.data(), remainder.data(), remainder.size());
+  pos = remainder.size();
 
   return len;
 }
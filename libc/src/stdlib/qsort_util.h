@@ -15,7 +15,9 @@
 
 namespace LIBC_NAMESPACE::internal {
 
-// A simple quicksort implementation using the Hoare partition scheme.
+// An introsort: a quicksort using the Hoare partition scheme that falls back
+// to heapsort when partitioning degenerates and finishes small ranges with
+// insertion sort.
 
 using Compare = int(const void *, const void *);
 using CompareWithState = int(const void *, const void *, void *);
@@ -134,17 +136,75 @@ static size_t partition(const Array &array) {
   }
 }
 
-LIBC_INLINE void quicksort(const Array &array) {
-  const size_t array_size = array.size();
-  if (array_size <= 1)
-    return;
-  size_t split_index = partition(array);
-  if (array_size <= 2) {
-    // The partition operation sorts the two element array.
-    return;
+// Ranges up to this size are sorted by insertion sort, which does less work
+// than partitioning them further.
+constexpr size_t INSERTION_SORT_THRESHOLD = 12;
+
+LIBC_INLINE void insertion_sort(const Array &array) {
+  for (size_t i = 1; i < array.size(); ++i)
+    for (size_t j = i; j > 0 && array.elem_compare(j - 1, array.get(j)) > 0;
+         --j)
+      array.swap(j - 1, j);
+}
+
+LIBC_INLINE void sift_down(const Array &array, size_t root, size_t size) {
+  while (true) {
+    size_t child = 2 * root + 1;
+    if (child >= size)
+      return;
+    if (child + 1 < size && array.elem_compare(child, array.get(child + 1)) < 0)
+      ++child;
+    if (array.elem_compare(root, array.get(child)) >= 0)
+      return;
+    array.swap(root, child);
+    root = child;
+  }
+}
+
+LIBC_INLINE void heap_sort(const Array &array) {
+  size_t size = array.size();
+  for (size_t i = size / 2; i > 0; --i)
+    sift_down(array, i - 1, size);
+  while (size > 1) {
+    --size;
+    array.swap(0, size);
+    sift_down(array, 0, size);
   }
-  quicksort(array.make_array(0, split_index));
-  quicksort(array.make_array(split_index, array.size() - split_index));
+}
+
+LIBC_INLINE void introsort(const Array &array, size_t depth_limit) {
+  size_t start = 0;
+  size_t size = array.size();
+  while (size > INSERTION_SORT_THRESHOLD) {
+    Array range = array.make_array(start, size);
+    // Too many unbalanced partitions: finish in O(n log n) regardless of the
+    // input.
+    if (depth_limit == 0) {
+      heap_sort(range);
+      return;
+    }
+    --depth_limit;
+    size_t split_index = partition(range);
+    // Recurse into the smaller part and loop on the larger one, so the stack
+    // depth stays logarithmic.
+    if (split_index < size - split_index) {
+      introsort(array.make_array(start, split_index), depth_limit);
+      start += split_index;
+      size -= split_index;
+    } else {
+      introsort(array.make_array(start + split_index, size - split_index),
+                depth_limit);
+      size = split_index;
+    }
+  }
+  insertion_sort(array.make_array(start, size));
+}
+
+LIBC_INLINE void quicksort(const Array &array) {
+  size_t depth_limit = 0;
+  for (size_t n = array.size(); n > 1; n >>= 1)
+    depth_limit += 2;
+  introsort(array, depth_limit);
 }
 
 } // namespace LIBC_NAMESPACE::internal
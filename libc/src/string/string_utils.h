@@ -67,12 +67,12 @@ LIBC_INLINE size_t string_length_wide_read(const char *src) {
       return char_ptr - src;
   }
   // Step 2: read blocks
-  for (const Word *block_ptr = reinterpret_cast<const Word *>(char_ptr);
-       !has_zeroes<Word>(*block_ptr); ++block_ptr) {
-    char_ptr = reinterpret_cast<const char *>(block_ptr);
-  }
+  const Word *block_ptr = reinterpret_cast<const Word *>(char_ptr);
+  while (!has_zeroes<Word>(*block_ptr))
+    ++block_ptr;
   // Step 3: find the zero in the block
-  for (; *char_ptr != '\0'; ++char_ptr) {
+  for (char_ptr = reinterpret_cast<const char *>(block_ptr); *char_ptr != '\0';
+       ++char_ptr) {
     ;
   }
   return char_ptr - src;
@@ -115,18 +115,19 @@ LIBC_INLINE void *find_first_character_wide_read(const unsigned char *src,
   const Word ch_mask = repeat_byte<Word>(ch);
 
   // Step 2: read blocks
-  for (const Word *block_ptr = reinterpret_cast<const Word *>(char_ptr);
-       !has_zeroes<Word>((*block_ptr) ^ ch_mask) && cur < n;
+  const Word *block_ptr = reinterpret_cast<const Word *>(char_ptr);
+  for (; cur < n && !has_zeroes<Word>((*block_ptr) ^ ch_mask);
        ++block_ptr, cur += sizeof(Word)) {
-    char_ptr = reinterpret_cast<const unsigned char *>(block_ptr);
+    ;
   }
 
   // Step 3: find the match in the block
-  for (; *char_ptr != ch && cur < n; ++char_ptr, ++cur) {
+  for (char_ptr = reinterpret_cast<const unsigned char *>(block_ptr);
+       cur < n && *char_ptr != ch; ++char_ptr, ++cur) {
     ;
   }
 
-  if (*char_ptr != ch || cur >= n)
+  if (cur >= n)
     return static_cast<void *>(nullptr);
 
   return const_cast<unsigned char *>(char_ptr);
@@ -227,6 +227,28 @@ TEST(LlvmLibcFileTest, WriteUnbuffered) {
   ASSERT_EQ(f->close(), 0);
 }
 
+TEST(LlvmLibcFileTest, LargeWriteBypassesBuffer) {
+  const char small[] = "abc";
+  const char large[] = "larger than the buffer";
+  constexpr size_t FILE_BUFFER_SIZE = sizeof(large) / 2;
+  char file_buffer[FILE_BUFFER_SIZE];
+  StringFile *f =
+      new_string_file(file_buffer, FILE_BUFFER_SIZE, _IOFBF, false, "w");
+
+  ASSERT_EQ(sizeof(small), f->write(small, sizeof(small)).value);
+  EXPECT_EQ(f->get_pos(), size_t(0));
+  // A write of at least a buffer worth of data flushes the pending data and
+  // is then written out directly.
+  ASSERT_EQ(sizeof(large), f->write(large, sizeof(large)).value);
+  constexpr size_t TOTAL_SIZE = sizeof(small) + sizeof(large);
+  MemoryView src("abc\0larger than the buffer", TOTAL_SIZE),
+      dst(f->get_str(), TOTAL_SIZE);
+  EXPECT_EQ(f->get_pos(), TOTAL_SIZE);
+  EXPECT_MEM_EQ(src, dst);
+
+  ASSERT_EQ(f->close(), 0);
+}
+
 TEST(LlvmLibcFileTest, ReadOnly) {
   const char initial_content[] = "1234567890987654321";
   constexpr size_t FILE_BUFFER_SIZE = sizeof(initial_content);
@@ -263,3 +263,30 @@ TEST(LlvmLibcQSortTest, SingleElementArray) {
 
   ASSERT_LE(array[0], ELEM);
 }
+
+static size_t num_compares;
+
+static int counting_int_compare(const void *l, const void *r) {
+  ++num_compares;
+  return int_compare(l, r);
+}
+
+TEST(LlvmLibcQsortTest, OrganPipeArray) {
+  // Ascending then descending input, which drives naive pivot choices into
+  // quadratic behavior.
+  constexpr size_t ARRAY_SIZE = 1000;
+  int array[ARRAY_SIZE];
+  for (size_t i = 0; i < ARRAY_SIZE; ++i)
+    array[i] = static_cast<int>(i < ARRAY_SIZE / 2 ? i : ARRAY_SIZE - i);
+
+  num_compares = 0;
+  LIBC_NAMESPACE::qsort(array, ARRAY_SIZE, sizeof(int), counting_int_compare);
+
+  for (size_t i = 1; i < ARRAY_SIZE; ++i)
+    ASSERT_LE(array[i - 1], array[i]);
+
+  // The sort must stay O(n log n): allow 4 * n * log2(n) comparisons, with
+  // log2(1000) rounded up to 10. A quadratic sort needs hundreds of
+  // thousands here.
+  ASSERT_LE(num_compares, 4 * ARRAY_SIZE * 10);
+}
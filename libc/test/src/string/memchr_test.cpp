@@ -33,6 +33,20 @@ TEST(LlvmLibcMemChrTest, FindsCharacterInNonNullTerminatedCollection) {
   ASSERT_EQ(ret[1], 'c');
 }
 
+TEST(LlvmLibcMemChrTest, FindsCharacterAtEveryPositionOfLongerBuffer) {
+  // Long enough for word-at-a-time implementations to skip whole blocks.
+  const size_t size = 64;
+  unsigned char src[size];
+  for (size_t i = 0; i < size; ++i)
+    src[i] = 'a';
+  for (size_t i = 0; i < size; ++i) {
+    src[i] = 'b';
+    ASSERT_EQ(call_memchr(src, 'b', size),
+              reinterpret_cast<const char *>(src + i));
+    src[i] = 'a';
+  }
+}
+
 TEST(LlvmLibcMemChrTest, FindsFirstCharacter) {
   const size_t size = 6;
   const unsigned char src[size] = {'a', 'b', 'c', 'd', 'e', '\0'};
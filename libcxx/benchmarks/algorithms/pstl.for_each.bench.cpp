@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <execution>
+#include <vector>
+
+static void bm_pstl_for_each(benchmark::State& state) {
+  std::vector<int> vec(state.range(), 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec);
+    std::for_each(std::execution::par, vec.begin(), vec.end(), [](int& v) { v = std::clamp(v, 10, 100); });
+  }
+}
+BENCHMARK(bm_pstl_for_each)->Range(1 << 10, 1 << 24)->UseRealTime();
+
+BENCHMARK_MAIN();
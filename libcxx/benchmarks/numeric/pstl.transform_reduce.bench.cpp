@@ -0,0 +1,27 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <benchmark/benchmark.h>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+static void bm_pstl_transform_reduce(benchmark::State& state) {
+  std::vector<double> vec1(state.range(), 1.5);
+  std::vector<double> vec2(state.range(), 2.5);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec1);
+    benchmark::DoNotOptimize(vec2);
+    benchmark::DoNotOptimize(std::transform_reduce(
+        std::execution::par, vec1.begin(), vec1.end(), vec2.begin(), 0.0, std::plus<>(), std::multiplies<>()));
+  }
+}
+BENCHMARK(bm_pstl_transform_reduce)->Range(1 << 10, 1 << 24)->UseRealTime();
+
+BENCHMARK_MAIN();
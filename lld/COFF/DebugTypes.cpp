@@ -1131,11 +1131,30 @@ void TypeMerger::mergeTypesWithGHash() {
   // - item records
   //   - source 0, type 1...
   //   - source 1, type 0...
-  std::vector<GHashCell> entries;
-  for (const GHashCell &cell : ArrayRef(ghashState.table.table, tableSize)) {
-    if (!cell.isEmpty())
-      entries.push_back(cell);
-  }
+  //
+  // The table is sized by the number of input records, so it is scanned in
+  // chunks in parallel: count the non-empty cells of each chunk, then copy
+  // them out at their prefix-sum positions.
+  ArrayRef<GHashCell> cells(ghashState.table.table, tableSize);
+  constexpr size_t cellsPerChunk = 1 << 16;
+  size_t numChunks = divideCeil(cells.size(), cellsPerChunk);
+  std::vector<size_t> chunkStarts(numChunks + 1);
+  parallelFor(0, numChunks, [&](size_t chunk) {
+    for (const GHashCell &cell : cells.slice(chunk * cellsPerChunk).take_front(
+             cellsPerChunk))
+      if (!cell.isEmpty())
+        ++chunkStarts[chunk + 1];
+  });
+  for (size_t chunk = 0; chunk < numChunks; ++chunk)
+    chunkStarts[chunk + 1] += chunkStarts[chunk];
+  std::vector<GHashCell> entries(chunkStarts[numChunks]);
+  parallelFor(0, numChunks, [&](size_t chunk) {
+    size_t pos = chunkStarts[chunk];
+    for (const GHashCell &cell : cells.slice(chunk * cellsPerChunk).take_front(
+             cellsPerChunk))
+      if (!cell.isEmpty())
+        entries[pos++] = cell;
+  });
   parallelSort(entries, std::less<GHashCell>());
   log(formatv("ghash table load factor: {0:p} (size {1} / capacity {2})\n",
               tableSize ? double(entries.size()) / tableSize : 0,
@@ -1155,20 +1174,31 @@ void TypeMerger::mergeTypesWithGHash() {
   // merging will skip indices not on this list. Store the destination PDB type
   // index for these unique types in the tpiMap for each source. The entries for
   // non-unique types will be filled in prior to type merging.
-  for (uint32_t i = 0, e = entries.size(); i < e; ++i) {
-    auto &cell = entries[i];
-    uint32_t tpiSrcIdx = cell.getTpiSrcIdx();
+  //
+  // Each source owns one contiguous run of type entries and one of item
+  // entries, and only writes the table cells it inserted, so sources can be
+  // processed in parallel.
+  parallelFor(0, ctx.tpiSourceList.size(), [&](size_t tpiSrcIdx) {
     TpiSource *source = ctx.tpiSourceList[tpiSrcIdx];
-    source->uniqueTypes.push_back(cell.getGHashIdx());
-
-    // Update the ghash table to store the destination PDB type index in the
-    // table.
-    uint32_t pdbTypeIndex = i < numTypes ? i : i - numTypes;
-    uint32_t ghashCellIndex =
-        source->indexMapStorage[cell.getGHashIdx()].toArrayIndex();
-    ghashState.table.table[ghashCellIndex] =
-        GHashCell(cell.isItem(), cell.getTpiSrcIdx(), pdbTypeIndex);
-  }
+    for (bool isItem : {false, true}) {
+      auto first = std::lower_bound(entries.begin(), entries.end(),
+                                    GHashCell(isItem, tpiSrcIdx, 0));
+      auto last = std::lower_bound(first, entries.end(),
+                                   GHashCell(isItem, tpiSrcIdx + 1, 0));
+      for (auto it = first; it != last; ++it) {
+        uint32_t i = std::distance(entries.begin(), it);
+        source->uniqueTypes.push_back(it->getGHashIdx());
+
+        // Update the ghash table to store the destination PDB type index in
+        // the table.
+        uint32_t pdbTypeIndex = i < numTypes ? i : i - numTypes;
+        uint32_t ghashCellIndex =
+            source->indexMapStorage[it->getGHashIdx()].toArrayIndex();
+        ghashState.table.table[ghashCellIndex] =
+            GHashCell(isItem, tpiSrcIdx, pdbTypeIndex);
+      }
+    }
+  });
 
   // In parallel, remap all types.
   for (TpiSource *source : dependencySources)
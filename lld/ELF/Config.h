@@ -179,6 +179,7 @@ struct Config {
   llvm::StringRef optRemarksFormat;
   llvm::StringRef optStatsFilename;
   llvm::StringRef progName;
+  llvm::StringRef linkProfile;
   llvm::StringRef printArchiveStats;
   llvm::StringRef printSymbolOrder;
   llvm::StringRef soName;
@@ -257,6 +258,7 @@ struct Config {
   bool hasDynSymTab;
   bool ignoreDataAddressEquality;
   bool ignoreFunctionAddressEquality;
+  bool incrementalWrite;
   bool ltoCSProfileGenerate;
   bool ltoPGOWarnMismatch;
   bool ltoDebugPassManager;
@@ -358,6 +360,7 @@ struct Config {
   uint64_t commonPageSize;
   uint64_t maxPageSize;
   uint64_t mipsGotSize;
+  uint64_t zHotTextAlign;
   uint64_t zStackSize;
   unsigned ltoPartitions;
   unsigned ltoo;
@@ -465,9 +468,19 @@ struct DuplicateSymbol {
   uint64_t value;
 };
 
+// Time spent on an input file in nanoseconds. Used by --link-profile=.
+struct InputFileTimes {
+  uint64_t parseNs = 0;
+  uint64_t scanNs = 0;
+};
+
 struct Ctx {
   LinkerDriver driver;
   SmallVector<std::unique_ptr<MemoryBuffer>> memoryBuffers;
+  // Input files opened ahead of time by prefetchInputFiles(), keyed by path.
+  // readFile() takes buffers out of here before going to the file system.
+  llvm::DenseMap<llvm::CachedHashStringRef, std::unique_ptr<MemoryBuffer>>
+      prefetchedBuffers;
   SmallVector<ELFFileBase *, 0> objectFiles;
   SmallVector<SharedFile *, 0> sharedFiles;
   SmallVector<BinaryFile *, 0> binaryFiles;
@@ -488,6 +501,8 @@ struct Ctx {
   llvm::DenseMap<const Symbol *,
                  std::pair<const InputFile *, const InputFile *>>
       backwardReferences;
+  // Per-file times collected for --link-profile=.
+  llvm::DenseMap<const InputFile *, InputFileTimes> fileTimes;
   llvm::SmallSet<llvm::StringRef, 0> auxiliaryFiles;
   // InputFile for linker created symbols with no source location.
   InputFile *internalFile;
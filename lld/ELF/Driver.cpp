@@ -59,6 +59,7 @@
 #include "llvm/Support/Compression.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/GlobPattern.h"
+#include "llvm/Support/JSON.h"
 #include "llvm/Support/LEB128.h"
 #include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
@@ -94,6 +95,7 @@ void elf::errorOrWarn(const Twine &msg) {
 void Ctx::reset() {
   driver = LinkerDriver();
   memoryBuffers.clear();
+  prefetchedBuffers.clear();
   objectFiles.clear();
   sharedFiles.clear();
   binaryFiles.clear();
@@ -105,6 +107,7 @@ void Ctx::reset() {
   nonPrevailingSyms.clear();
   whyExtractRecords.clear();
   backwardReferences.clear();
+  fileTimes.clear();
   auxiliaryFiles.clear();
   internalFile = nullptr;
   hasSympart.store(false, std::memory_order_relaxed);
@@ -1304,6 +1307,8 @@ static void readConfigs(opt::InputArgList &args) {
       args.hasArg(OPT_ignore_data_address_equality);
   config->ignoreFunctionAddressEquality =
       args.hasArg(OPT_ignore_function_address_equality);
+  config->incrementalWrite =
+      args.hasFlag(OPT_incremental_write, OPT_no_incremental_write, false);
   config->init = args.getLastArgValue(OPT_init, "_init");
   config->ltoAAPipeline = args.getLastArgValue(OPT_lto_aa_pipeline);
   config->ltoCSProfileGenerate = args.hasArg(OPT_lto_cs_profile_generate);
@@ -1376,6 +1381,7 @@ static void readConfigs(opt::InputArgList &args) {
   config->printGcSections =
       args.hasFlag(OPT_print_gc_sections, OPT_no_print_gc_sections, false);
   config->printMemoryUsage = args.hasArg(OPT_print_memory_usage);
+  config->linkProfile = args.getLastArgValue(OPT_link_profile);
   config->printArchiveStats = args.getLastArgValue(OPT_print_archive_stats);
   config->printSymbolOrder =
       args.getLastArgValue(OPT_print_symbol_order);
@@ -1467,6 +1473,12 @@ static void readConfigs(opt::InputArgList &args) {
   config->zGlobal = hasZOption(args, "global");
   config->zGnustack = getZGnuStack(args);
   config->zHazardplt = hasZOption(args, "hazardplt");
+  config->zHotTextAlign =
+      args::getZOptionValue(args, OPT_z, "hot-text-align", 0);
+  if (!isPowerOf2_64(config->zHotTextAlign) && config->zHotTextAlign != 0)
+    error("hot-text-align: value isn't a power of 2");
+  else if (config->zHotTextAlign > UINT32_MAX)
+    error("hot-text-align: value is too large");
   config->zIfuncNoplt = hasZOption(args, "ifunc-noplt");
   config->zInitfirst = hasZOption(args, "initfirst");
   config->zInterpose = hasZOption(args, "interpose");
@@ -1887,8 +1899,41 @@ static bool isFormatBinary(StringRef s) {
   return false;
 }
 
+// Input files are otherwise opened and mapped one at a time while walking the
+// command line, which makes the link latency-bound on network file systems.
+// Open the files named directly on the command line in parallel up front;
+// readFile() then picks them up in command line order. Failures are ignored
+// here and reported by readFile().
+static void prefetchInputFiles(opt::InputArgList &args) {
+  // readFile() rewrites paths for these options, and the rewritten path is
+  // what the prefetched buffers would have to be keyed by.
+  if (!config->chroot.empty() || !config->remapInputs.empty() ||
+      !config->remapInputsWildcards.empty())
+    return;
+
+  SmallVector<StringRef, 0> paths;
+  for (auto *arg : args.filtered(OPT_INPUT))
+    paths.push_back(arg->getValue());
+  if (paths.size() < 2)
+    return;
+
+  llvm::TimeTraceScope timeScope("Prefetch input files");
+  std::vector<std::unique_ptr<MemoryBuffer>> mbs(paths.size());
+  parallelFor(0, paths.size(), [&](size_t i) {
+    auto mbOrErr = MemoryBuffer::getFile(paths[i], /*IsText=*/false,
+                                         /*RequiresNullTerminator=*/false);
+    if (mbOrErr)
+      mbs[i] = std::move(*mbOrErr);
+  });
+  for (size_t i = 0, e = paths.size(); i != e; ++i)
+    if (mbs[i])
+      ctx.prefetchedBuffers.try_emplace(CachedHashStringRef(paths[i]),
+                                        std::move(mbs[i]));
+}
+
 void LinkerDriver::createFiles(opt::InputArgList &args) {
   llvm::TimeTraceScope timeScope("Load input files");
+  prefetchInputFiles(args);
   // For --{push,pop}-state.
   std::vector<std::tuple<bool, bool, bool>> stack;
 
@@ -2209,6 +2254,62 @@ static void writeArchiveStats() {
   }
 }
 
+// Handle --link-profile=. Report, for each input file, where link time went and
+// how many bytes of its sections were kept, garbage collected or folded by ICF.
+static void writeLinkProfile() {
+  if (config->linkProfile.empty())
+    return;
+
+  std::error_code ec;
+  raw_fd_ostream os = ctx.openAuxiliaryFile(config->linkProfile, ec);
+  if (ec) {
+    error("--link-profile=: cannot open " + config->linkProfile + ": " +
+          ec.message());
+    return;
+  }
+
+  json::OStream json(os, 2);
+  auto writeCommon = [&](const InputFile *file) {
+    InputFileTimes times = ctx.fileTimes.lookup(file);
+    json.attribute("name", toString(file));
+    if (!file->archiveName.empty())
+      json.attribute("archive", file->archiveName);
+    json.attribute("size", int64_t(file->mb.getBufferSize()));
+    json.attribute("parseUs", int64_t(times.parseNs / 1000));
+    json.attribute("scanUs", int64_t(times.scanNs / 1000));
+  };
+
+  json.object([&] {
+    json.attributeArray("files", [&] {
+      for (ELFFileBase *file : ctx.objectFiles) {
+        uint64_t liveBytes = 0, gcBytes = 0, icfBytes = 0;
+        for (InputSectionBase *s : file->getSections()) {
+          if (!s || s == &InputSection::discarded)
+            continue;
+          auto *isec = dyn_cast<InputSection>(s);
+          if (isec && isec->repl != isec)
+            icfBytes += s->size;
+          else if (s->isLive())
+            liveBytes += s->size;
+          else
+            gcBytes += s->size;
+        }
+        json.object([&] {
+          writeCommon(file);
+          json.attribute("liveBytes", int64_t(liveBytes));
+          json.attribute("gcBytes", int64_t(gcBytes));
+          json.attribute("icfBytes", int64_t(icfBytes));
+        });
+      }
+      for (BitcodeFile *file : ctx.bitcodeFiles)
+        json.object([&] { writeCommon(file); });
+      for (SharedFile *file : ctx.sharedFiles)
+        json.object([&] { writeCommon(file); });
+    });
+  });
+  os << '\n';
+}
+
 static void writeWhyExtract() {
   if (config->whyExtract.empty())
     return;
@@ -3149,4 +3250,7 @@ template <class ELFT> void LinkerDriver::link(opt::InputArgList &args) {
 
   // Write the result to the file.
   writeResult<ELFT>();
+
+  // Handle --link-profile= now that GC, ICF and relocation scanning are done.
+  writeLinkProfile();
 }
@@ -120,8 +120,14 @@ private:
 
   void forEachClass(llvm::function_ref<void(size_t, size_t)> fn);
 
+  void removeSingletons();
+
   SmallVector<InputSection *, 0> sections;
 
+  // The next ID handed out by removeSingletons(). It starts above any ID that
+  // segregate() can assign so that the two never collide.
+  uint32_t frozenId = 0;
+
   // We repeat the main loop while `Repeat` is true.
   std::atomic<bool> repeat;
 
@@ -408,6 +414,9 @@ void ICF<ELFT>::forEachClass(llvm::function_ref<void(size_t, size_t)> fn) {
   // If threading is disabled or the number of sections are
   // too small to use threading, call Fn sequentially.
   if (parallel::strategy.ThreadsRequested == 1 || sections.size() < 1024) {
+    // removeSingletons() may have shrunk the vector after previous rounds ran
+    // in parallel. Continue from the slot they wrote to.
+    current = next;
     forEachClassRange(0, sections.size(), fn);
     ++cnt;
     return;
@@ -437,6 +446,29 @@ void ICF<ELFT>::forEachClass(llvm::function_ref<void(size_t, size_t)> fn) {
   ++cnt;
 }
 
+// Equivalence classes only ever split, so a section that is alone in its class
+// can never be folded. Remove such sections from the vector so that later
+// rounds do not revisit them. A removed section gets a fresh ID in both slots,
+// which keeps relocations referring to it comparable in subsequent rounds.
+template <class ELFT> void ICF<ELFT>::removeSingletons() {
+  // The latest round wrote its results to `next`.
+  size_t out = 0;
+  for (size_t begin = 0, end; begin < sections.size(); begin = end) {
+    uint32_t eqClass = sections[begin]->eqClass[next];
+    for (end = begin + 1; end < sections.size(); ++end)
+      if (sections[end]->eqClass[next] != eqClass)
+        break;
+    if (end - begin == 1) {
+      InputSection *s = sections[begin];
+      s->eqClass[0] = s->eqClass[1] = frozenId++;
+      continue;
+    }
+    for (size_t i = begin; i < end; ++i)
+      sections[out++] = sections[i];
+  }
+  sections.truncate(out);
+}
+
 // Combine the hashes of the sections referenced by the given section into its
 // hash.
 template <class RelTy>
@@ -522,9 +554,11 @@ template <class ELFT> void ICF<ELFT>::run() {
   // static content. Use a base offset for these IDs to ensure no overlap with
   // the unique IDs already assigned.
   uint32_t eqClassBase = ++uniqueId;
+  frozenId = eqClassBase + sections.size() + 1;
   forEachClass([&](size_t begin, size_t end) {
     segregate(begin, end, eqClassBase, true);
   });
+  removeSingletons();
 
   // Split groups by comparing relocations until convergence is obtained.
   do {
@@ -532,6 +566,7 @@ template <class ELFT> void ICF<ELFT>::run() {
     forEachClass([&](size_t begin, size_t end) {
       segregate(begin, end, eqClassBase, false);
     });
+    removeSingletons();
   } while (repeat);
 
   log("ICF needed " + Twine(cnt) + " iterations");
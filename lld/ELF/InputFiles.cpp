@@ -31,6 +31,7 @@
 #include "llvm/Support/TarWriter.h"
 #include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/raw_ostream.h"
+#include <chrono>
 #include <optional>
 
 using namespace llvm;
@@ -251,15 +252,23 @@ std::optional<MemoryBufferRef> elf::readFile(StringRef path) {
   log(path);
   config->dependencyFiles.insert(llvm::CachedHashString(path));
 
-  auto mbOrErr = MemoryBuffer::getFile(path, /*IsText=*/false,
-                                       /*RequiresNullTerminator=*/false);
-  if (auto ec = mbOrErr.getError()) {
-    error("cannot open " + path + ": " + ec.message());
-    return std::nullopt;
+  std::unique_ptr<MemoryBuffer> mb;
+  auto prefetched = ctx.prefetchedBuffers.find(CachedHashStringRef(path));
+  if (prefetched != ctx.prefetchedBuffers.end()) {
+    mb = std::move(prefetched->second);
+    ctx.prefetchedBuffers.erase(prefetched);
+  } else {
+    auto mbOrErr = MemoryBuffer::getFile(path, /*IsText=*/false,
+                                         /*RequiresNullTerminator=*/false);
+    if (auto ec = mbOrErr.getError()) {
+      error("cannot open " + path + ": " + ec.message());
+      return std::nullopt;
+    }
+    mb = std::move(*mbOrErr);
   }
 
-  MemoryBufferRef mbref = (*mbOrErr)->getMemBufferRef();
-  ctx.memoryBuffers.push_back(std::move(*mbOrErr)); // take MB ownership
+  MemoryBufferRef mbref = mb->getMemBufferRef();
+  ctx.memoryBuffers.push_back(std::move(mb)); // take MB ownership
 
   if (tar)
     tar->append(relativeToRoot(path), mbref.getBuffer());
@@ -301,7 +310,7 @@ static bool isCompatible(InputFile *file) {
   return false;
 }
 
-template <class ELFT> static void doParseFile(InputFile *file) {
+template <class ELFT> static void doParseFileImpl(InputFile *file) {
   if (!isCompatible(file))
     return;
 
@@ -333,6 +342,25 @@ template <class ELFT> static void doParseFile(InputFile *file) {
   }
 }
 
+// Time spent parsing files nested in the current doParseFile call. Parsing a
+// file may extract archive members, which are parsed recursively. For
+// --link-profile=, their time is attributed to the members themselves.
+static uint64_t nestedParseNs = 0;
+
+template <class ELFT> static void doParseFile(InputFile *file) {
+  if (config->linkProfile.empty())
+    return doParseFileImpl<ELFT>(file);
+
+  uint64_t savedNestedNs = std::exchange(nestedParseNs, 0);
+  auto start = std::chrono::steady_clock::now();
+  doParseFileImpl<ELFT>(file);
+  uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+  ctx.fileTimes[file].parseNs += ns - nestedParseNs;
+  nestedParseNs = savedNestedNs + ns;
+}
+
 // Add symbols in File to the symbol table.
 void elf::parseFile(InputFile *file) { invokeELFT(doParseFile, file); }
 
@@ -1882,9 +1910,10 @@ ELFFileBase *elf::createObjFile(MemoryBufferRef mb, StringRef archiveName,
 }
 
 template <class ELFT> void ObjFile<ELFT>::parseLazy() {
+  // Don't allocate the symbols array here. Most archive members in a typical
+  // link are never extracted, and for those the array would be pure overhead.
+  // initializeSymbols() allocates it if this file is extracted.
   const ArrayRef<typename ELFT::Sym> eSyms = this->getELFSyms<ELFT>();
-  numSymbols = eSyms.size();
-  symbols = std::make_unique<Symbol *[]>(numSymbols);
 
   // resolve() may trigger this->extract() if an existing symbol is an undefined
   // symbol. If that happens, this function has served its purpose, and we can
@@ -1892,8 +1921,8 @@ template <class ELFT> void ObjFile<ELFT>::parseLazy() {
   for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i) {
     if (eSyms[i].st_shndx == SHN_UNDEF)
       continue;
-    symbols[i] = symtab.insert(CHECK(eSyms[i].getName(stringTable), this));
-    symbols[i]->resolve(LazySymbol{*this});
+    Symbol *sym = symtab.insert(CHECK(eSyms[i].getName(stringTable), this));
+    sym->resolve(LazySymbol{*this});
     if (!lazy)
       break;
   }
@@ -31,7 +31,9 @@
 #include "lld/Common/Strings.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/Object/ELF.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/TimeProfiler.h"
+#include <atomic>
 #include <vector>
 
 using namespace llvm;
@@ -53,6 +55,8 @@ private:
   void enqueue(InputSectionBase *sec, uint64_t offset);
   void markSymbol(Symbol *sym);
   void mark();
+  void markParallel();
+  void visit(InputSectionBase &sec);
 
   template <class RelTy>
   void resolveReloc(InputSectionBase &sec, RelTy &rel, bool fromFDE);
@@ -66,6 +70,19 @@ private:
   // A list of sections to visit.
   SmallVector<InputSection *, 0> queue;
 
+  // Per-thread state used by markParallel(). Each worker drains its own
+  // queue and hands off part of it to a new task when it grows large. Writes
+  // to bitfields that may be shared between threads (section piece and symbol
+  // flags) are buffered and applied after all workers have finished.
+  struct Worker {
+    SmallVector<InputSection *, 0> queue;
+    SmallVector<SectionPiece *, 0> livePieces;
+    SmallVector<Symbol *, 0> usedSymbols;
+    SmallVector<SharedFile *, 0> neededFiles;
+  };
+  SmallVector<Worker, 0> workers;
+  parallel::TaskGroup *tg = nullptr;
+
   // There are normally few input sections whose names are valid C
   // identifiers, so we just store a SmallVector instead of a multimap.
   DenseMap<StringRef, SmallVector<InputSectionBase *, 0>> cNamedSections;
@@ -91,7 +108,10 @@ void MarkLive<ELFT>::resolveReloc(InputSectionBase &sec, RelTy &rel,
                                   bool fromFDE) {
   // If a symbol is referenced in a live section, it is used.
   Symbol &sym = sec.file->getRelocTargetSym(rel);
-  sym.used = true;
+  if (!tg)
+    sym.used = true;
+  else if (!sym.used)
+    workers[parallel::getThreadIndex()].usedSymbols.push_back(&sym);
 
   if (auto *d = dyn_cast<Defined>(&sym)) {
     auto *relSec = dyn_cast_or_null<InputSectionBase>(d->section);
@@ -117,8 +137,13 @@ void MarkLive<ELFT>::resolveReloc(InputSectionBase &sec, RelTy &rel,
   }
 
   if (auto *ss = dyn_cast<SharedSymbol>(&sym))
-    if (!ss->isWeak())
-      cast<SharedFile>(ss->file)->isNeeded = true;
+    if (!ss->isWeak()) {
+      auto *file = cast<SharedFile>(ss->file);
+      if (!tg)
+        file->isNeeded = true;
+      else if (!file->isNeeded)
+        workers[parallel::getThreadIndex()].neededFiles.push_back(file);
+    }
 
   for (InputSectionBase *sec : cNamedSections.lookup(sym.getName()))
     enqueue(sec, 0);
@@ -183,6 +208,25 @@ void MarkLive<ELFT>::enqueue(InputSectionBase *sec, uint64_t offset) {
   // Usually, a whole section is marked as live or dead, but in mergeable
   // (splittable) sections, each piece of data has independent liveness bit.
   // So we explicitly tell it which offset is in use.
+  if (tg) {
+    Worker &w = workers[parallel::getThreadIndex()];
+    if (auto *ms = dyn_cast<MergeInputSection>(sec)) {
+      SectionPiece &piece = ms->getSectionPiece(offset);
+      if (!piece.live)
+        w.livePieces.push_back(&piece);
+    }
+
+    // Only the main partition is marked in parallel, so the lattice collapses
+    // to 0 -> 1 and the thread that flips the byte owns the section.
+    auto &part = *reinterpret_cast<std::atomic<uint8_t> *>(&sec->partition);
+    if (part.load(std::memory_order_relaxed) == 1 ||
+        part.exchange(1, std::memory_order_relaxed) == 1)
+      return;
+    if (InputSection *s = dyn_cast<InputSection>(sec))
+      w.queue.push_back(s);
+    return;
+  }
+
   if (auto *ms = dyn_cast<MergeInputSection>(sec))
     ms->getSectionPiece(offset).live = true;
 
@@ -300,24 +344,83 @@ template <class ELFT> void MarkLive<ELFT>::run() {
   mark();
 }
 
-template <class ELFT> void MarkLive<ELFT>::mark() {
-  // Mark all reachable sections.
-  while (!queue.empty()) {
-    InputSectionBase &sec = *queue.pop_back_val();
+template <class ELFT> void MarkLive<ELFT>::visit(InputSectionBase &sec) {
+  const RelsOrRelas<ELFT> rels = sec.template relsOrRelas<ELFT>();
+  for (const typename ELFT::Rel &rel : rels.rels)
+    resolveReloc(sec, rel, false);
+  for (const typename ELFT::Rela &rel : rels.relas)
+    resolveReloc(sec, rel, false);
 
-    const RelsOrRelas<ELFT> rels = sec.template relsOrRelas<ELFT>();
-    for (const typename ELFT::Rel &rel : rels.rels)
-      resolveReloc(sec, rel, false);
-    for (const typename ELFT::Rela &rel : rels.relas)
-      resolveReloc(sec, rel, false);
+  for (InputSectionBase *isec : sec.dependentSections)
+    enqueue(isec, 0);
 
-    for (InputSectionBase *isec : sec.dependentSections)
-      enqueue(isec, 0);
+  // Mark the next group member.
+  if (sec.nextInSectionGroup)
+    enqueue(sec.nextInSectionGroup, 0);
+}
 
-    // Mark the next group member.
-    if (sec.nextInSectionGroup)
-      enqueue(sec.nextInSectionGroup, 0);
+template <class ELFT> void MarkLive<ELFT>::mark() {
+  // With a single partition, liveness is a plain 0 -> 1 transition that can be
+  // claimed atomically, so the graph can be traversed by several threads.
+  if (partitions.size() == 1 && config->threadCount > 1) {
+    markParallel();
+    return;
+  }
+
+  // Mark all reachable sections.
+  while (!queue.empty())
+    visit(*queue.pop_back_val());
+}
+
+template <class ELFT> void MarkLive<ELFT>::markParallel() {
+  // Sections are handed to other threads in batches of this size. When a
+  // worker's queue grows beyond twice this, the excess is spawned as a new
+  // task so that idle threads can pick it up.
+  constexpr size_t batchSize = 256;
+
+  workers.resize(config->threadCount);
+  std::function<void(SmallVector<InputSection *, 0>)> process;
+  {
+    parallel::TaskGroup taskGroup;
+    tg = &taskGroup;
+    process = [&](SmallVector<InputSection *, 0> batch) {
+      Worker &w = workers[parallel::getThreadIndex()];
+      w.queue.append(batch.begin(), batch.end());
+      while (!w.queue.empty()) {
+        if (w.queue.size() >= 2 * batchSize) {
+          SmallVector<InputSection *, 0> rest(w.queue.end() - batchSize,
+                                              w.queue.end());
+          w.queue.truncate(w.queue.size() - batchSize);
+          taskGroup.spawn([&, rest = std::move(rest)]() mutable {
+            process(std::move(rest));
+          });
+        }
+        visit(*w.queue.pop_back_val());
+      }
+    };
+    for (size_t i = 0, e = queue.size(); i < e; i += batchSize) {
+      SmallVector<InputSection *, 0> batch(
+          queue.begin() + i, queue.begin() + std::min(i + batchSize, e));
+      taskGroup.spawn([&, batch = std::move(batch)]() mutable {
+        process(std::move(batch));
+      });
+    }
+    queue.clear();
+  }
+  tg = nullptr;
+
+  // Apply the buffered writes. The set of live sections does not depend on the
+  // traversal order, and these are all idempotent, so the result is the same
+  // as a serial mark.
+  for (Worker &w : workers) {
+    for (SectionPiece *piece : w.livePieces)
+      piece->live = true;
+    for (Symbol *sym : w.usedSymbols)
+      sym->used = true;
+    for (SharedFile *file : w.neededFiles)
+      file->isNeeded = true;
   }
+  workers.clear();
 }
 
 // Move the sections for some symbols to the main partition, specifically ifuncs
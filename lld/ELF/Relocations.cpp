@@ -57,6 +57,7 @@
 #include "llvm/Demangle/Demangle.h"
 #include "llvm/Support/Endian.h"
 #include <algorithm>
+#include <chrono>
 
 using namespace llvm;
 using namespace llvm::ELF;
@@ -1618,31 +1619,62 @@ template <class ELFT> void elf::scanRelocations() {
   // for parallelism.
   bool serial = !config->zCombreloc || config->emachine == EM_MIPS ||
                 config->emachine == EM_PPC64;
-  parallel::TaskGroup tg;
-  for (ELFFileBase *f : ctx.objectFiles) {
-    auto fn = [f]() {
+
+  // Split the work into fixed-size chunks of sections rather than one task per
+  // file, so that a single large object file (e.g. the output of LTO) does not
+  // serialize scanning. Dynamic relocations are collected in per-thread vectors
+  // and sorted after merging, so the result does not depend on the split.
+  SmallVector<InputSectionBase *, 0> sections;
+  for (ELFFileBase *f : ctx.objectFiles)
+    for (InputSectionBase *s : f->getSections())
+      if (s && s->kind() == SectionBase::Regular && s->isLive() &&
+          (s->flags & SHF_ALLOC) &&
+          !(s->type == SHT_ARM_EXIDX && config->emachine == EM_ARM))
+        sections.push_back(s);
+
+  // For --link-profile=, record the scan time of each section. Each slot is
+  // written by exactly one task.
+  SmallVector<uint64_t, 0> scanNs;
+  if (!config->linkProfile.empty())
+    scanNs.resize(sections.size());
+
+  constexpr size_t chunkSize = 256;
+  {
+    parallel::TaskGroup tg;
+    for (size_t begin = 0; begin < sections.size(); begin += chunkSize) {
+      auto fn = [&sections, &scanNs, begin]() {
+        RelocationScanner scanner;
+        size_t end = std::min(begin + chunkSize, sections.size());
+        for (size_t i = begin; i != end; ++i) {
+          if (scanNs.empty()) {
+            scanner.template scanSection<ELFT>(*sections[i]);
+            continue;
+          }
+          auto start = std::chrono::steady_clock::now();
+          scanner.template scanSection<ELFT>(*sections[i]);
+          scanNs[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+        }
+      };
+      tg.spawn(fn, serial);
+    }
+
+    tg.spawn([] {
       RelocationScanner scanner;
-      for (InputSectionBase *s : f->getSections()) {
-        if (s && s->kind() == SectionBase::Regular && s->isLive() &&
-            (s->flags & SHF_ALLOC) &&
-            !(s->type == SHT_ARM_EXIDX && config->emachine == EM_ARM))
-          scanner.template scanSection<ELFT>(*s);
+      for (Partition &part : partitions) {
+        for (EhInputSection *sec : part.ehFrame->sections)
+          scanner.template scanSection<ELFT>(*sec);
+        if (part.armExidx && part.armExidx->isLive())
+          for (InputSection *sec : part.armExidx->exidxSections)
+            if (sec->isLive())
+              scanner.template scanSection<ELFT>(*sec);
       }
-    };
-    tg.spawn(fn, serial);
+    });
   }
 
-  tg.spawn([] {
-    RelocationScanner scanner;
-    for (Partition &part : partitions) {
-      for (EhInputSection *sec : part.ehFrame->sections)
-        scanner.template scanSection<ELFT>(*sec);
-      if (part.armExidx && part.armExidx->isLive())
-        for (InputSection *sec : part.armExidx->exidxSections)
-          if (sec->isLive())
-            scanner.template scanSection<ELFT>(*sec);
-    }
-  });
+  for (size_t i = 0, e = scanNs.size(); i != e; ++i)
+    ctx.fileTimes[sections[i]->file].scanNs += scanNs[i];
 }
 
 static bool handleNonPreemptibleIfunc(Symbol &sym, uint16_t flags) {
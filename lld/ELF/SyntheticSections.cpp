@@ -3879,8 +3879,57 @@ void MergeTailSection::finalizeContents() {
 }
 
 void MergeNoTailSection::writeTo(uint8_t *buf) {
-  parallelFor(0, numShards,
-              [&](size_t i) { shards[i].write(buf + shardOffsets[i]); });
+  parallelFor(0, numShards, [&](size_t i) {
+    for (const Slot &slot : shards[i].slots) {
+      if (slot.secIdx == UINT32_MAX)
+        continue;
+      const MergeInputSection *sec = sections[slot.secIdx];
+      StringRef data = sec->getData(slot.pieceIdx).val();
+      memcpy(buf + sec->pieces[slot.pieceIdx].outputOff, data.data(),
+             data.size());
+    }
+  });
+}
+
+// Adds a piece to a shard and returns its offset within the shard. If an
+// identical piece has been added before, the offset of the earlier copy is
+// returned.
+uint64_t MergeNoTailSection::addToShard(Shard &shard, uint32_t secIdx,
+                                        uint32_t pieceIdx) {
+  // Keep the load factor below 3/4. Rehashing only needs the stored hashes.
+  if ((shard.numEntries + 1) * 4 > shard.slots.size() * 3) {
+    SmallVector<Slot, 0> old = std::move(shard.slots);
+    shard.slots.assign(std::max<size_t>(old.size() * 2, 1024),
+                       Slot{0, UINT32_MAX, 0});
+    size_t mask = shard.slots.size() - 1;
+    for (const Slot &slot : old) {
+      if (slot.secIdx == UINT32_MAX)
+        continue;
+      size_t i = slot.hash & mask;
+      while (shard.slots[i].secIdx != UINT32_MAX)
+        i = (i + 1) & mask;
+      shard.slots[i] = slot;
+    }
+  }
+
+  const MergeInputSection *sec = sections[secIdx];
+  CachedHashStringRef data = sec->getData(pieceIdx);
+  size_t mask = shard.slots.size() - 1;
+  for (size_t i = data.hash() & mask;; i = (i + 1) & mask) {
+    Slot &slot = shard.slots[i];
+    if (slot.secIdx == UINT32_MAX) {
+      slot = {data.hash(), secIdx, pieceIdx};
+      ++shard.numEntries;
+      uint64_t off = alignToPowerOf2(shard.size, addralign);
+      shard.size = off + data.size();
+      return off;
+    }
+    if (slot.hash != data.hash())
+      continue;
+    const MergeInputSection *other = sections[slot.secIdx];
+    if (other->getData(slot.pieceIdx).val() == data.val())
+      return other->pieces[slot.pieceIdx].outputOff;
+  }
 }
 
 // This function is very hot (i.e. it can take several seconds to finish)
@@ -3892,10 +3941,6 @@ void MergeNoTailSection::writeTo(uint8_t *buf) {
 // T into different string builders without worrying about merge misses.
 // We do it in parallel.
 void MergeNoTailSection::finalizeContents() {
-  // Initializes string table builders.
-  for (size_t i = 0; i < numShards; ++i)
-    shards.emplace_back(StringTableBuilder::RAW, llvm::Align(addralign));
-
   // Concurrency level. Must be a power of 2 to avoid expensive modulo
   // operations in the following tight loop.
   const size_t concurrency =
@@ -3903,13 +3948,14 @@ void MergeNoTailSection::finalizeContents() {
 
   // Add section pieces to the builders.
   parallelFor(0, concurrency, [&](size_t threadId) {
-    for (MergeInputSection *sec : sections) {
+    for (size_t secIdx = 0, e = sections.size(); secIdx != e; ++secIdx) {
+      MergeInputSection *sec = sections[secIdx];
       for (size_t i = 0, e = sec->pieces.size(); i != e; ++i) {
         if (!sec->pieces[i].live)
           continue;
         size_t shardId = getShardId(sec->pieces[i].hash);
         if ((shardId & (concurrency - 1)) == threadId)
-          sec->pieces[i].outputOff = shards[shardId].add(sec->getData(i));
+          sec->pieces[i].outputOff = addToShard(shards[shardId], secIdx, i);
       }
     }
   });
@@ -3917,11 +3963,10 @@ void MergeNoTailSection::finalizeContents() {
   // Compute an in-section offset for each shard.
   size_t off = 0;
   for (size_t i = 0; i < numShards; ++i) {
-    shards[i].finalizeInOrder();
-    if (shards[i].getSize() > 0)
+    if (shards[i].size > 0)
       off = alignToPowerOf2(off, addralign);
     shardOffsets[i] = off;
-    off += shards[i].getSize();
+    off += shards[i].size;
   }
   size = off;
 
@@ -1118,12 +1118,30 @@ private:
     return hash >> (31 - llvm::countr_zero(numShards));
   }
 
+  // An open-addressing hash table of unique pieces. Each shard is only ever
+  // touched by one thread, so no synchronization is needed. A slot refers to
+  // the first occurrence of a piece in input order by index rather than
+  // holding a copy of the string, and the piece's precomputed hash is used
+  // both for probing and for growing the table.
+  struct Slot {
+    uint32_t hash;
+    uint32_t secIdx; // UINT32_MAX if the slot is empty
+    uint32_t pieceIdx;
+  };
+  struct Shard {
+    SmallVector<Slot, 0> slots;
+    size_t numEntries = 0;
+    size_t size = 0;
+  };
+
+  uint64_t addToShard(Shard &shard, uint32_t secIdx, uint32_t pieceIdx);
+
   // Section size
   size_t size;
 
   // String table contents
   constexpr static size_t numShards = 32;
-  SmallVector<llvm::StringTableBuilder, 0> shards;
+  Shard shards[numShards];
   size_t shardOffsets[numShards];
 };
 
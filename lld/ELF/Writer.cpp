@@ -1093,8 +1093,9 @@ static DenseMap<const InputSectionBase *, int> buildSectionOrder() {
   return sectionOrder;
 }
 
-// Sorts the sections in ISD according to the provided section order.
-static void
+// Sorts the sections in ISD according to the provided section order. Returns
+// true if the ordered sections were aligned for -z hot-text-align=.
+static bool
 sortISDBySectionOrder(InputSectionDescription *isd,
                       const DenseMap<const InputSectionBase *, int> &order,
                       bool executableOutputSection) {
@@ -1160,6 +1161,25 @@ sortISDBySectionOrder(InputSectionDescription *isd,
     }
   }
 
+  // With -z hot-text-align=, the ordered region is expected to be hot code
+  // (e.g. laid out by --call-graph-profile-sort). Align its start and the
+  // section following it so that the region occupies whole (huge) pages and
+  // does not share an i-TLB entry with cold code. The caller raises the
+  // alignment of the output section to match, since input section offsets
+  // are only aligned relative to its start.
+  bool alignedHotText = executableOutputSection && config->zHotTextAlign &&
+                        !orderedSections.empty();
+  if (alignedHotText) {
+    InputSection *first = orderedSections.front().first;
+    first->addralign =
+        std::max<uint32_t>(first->addralign, config->zHotTextAlign);
+    if (insPt != unorderedSections.size()) {
+      InputSection *next = unorderedSections[insPt];
+      next->addralign =
+          std::max<uint32_t>(next->addralign, config->zHotTextAlign);
+    }
+  }
+
   isd->sections.clear();
   for (InputSection *isec : ArrayRef(unorderedSections).slice(0, insPt))
     isd->sections.push_back(isec);
@@ -1167,6 +1187,7 @@ sortISDBySectionOrder(InputSectionDescription *isd,
     isd->sections.push_back(p.first);
   for (InputSection *isec : ArrayRef(unorderedSections).slice(insPt))
     isd->sections.push_back(isec);
+  return alignedHotText;
 }
 
 static void sortSection(OutputSection &osec,
@@ -1184,7 +1205,9 @@ static void sortSection(OutputSection &osec,
   if (!order.empty())
     for (SectionCommand *b : osec.commands)
       if (auto *isd = dyn_cast<InputSectionDescription>(b))
-        sortISDBySectionOrder(isd, order, osec.flags & SHF_EXECINSTR);
+        if (sortISDBySectionOrder(isd, order, osec.flags & SHF_EXECINSTR))
+          osec.addralign =
+              std::max<uint32_t>(osec.addralign, config->zHotTextAlign);
 
   if (script->hasSectionsCommand)
     return;
@@ -2696,12 +2719,24 @@ template <class ELFT> void Writer<ELFT>::openFile() {
     return;
   }
 
-  unlinkAsync(config->outputFile);
   unsigned flags = 0;
   if (!config->relocatable)
     flags |= FileOutputBuffer::F_executable;
   if (!config->mmapOutputFile)
     flags |= FileOutputBuffer::F_no_mmap;
+
+  // With --incremental-write, keep an existing output of the same size so that
+  // FileOutputBuffer can rewrite only the pages whose contents changed. This
+  // is cheap for large debug builds relinked after a small change, where most
+  // of the sections land at the same file offsets with the same contents.
+  // FileOutputBuffer falls back to replacing the file if it is in use.
+  uint64_t existingSize;
+  if (config->incrementalWrite &&
+      !sys::fs::file_size(config->outputFile, existingSize) &&
+      existingSize == fileSize)
+    flags |= FileOutputBuffer::F_update_in_place;
+  else
+    unlinkAsync(config->outputFile);
   Expected<std::unique_ptr<FileOutputBuffer>> bufferOrErr =
       FileOutputBuffer::create(config->outputFile, fileSize, flags);
 
@@ -2466,11 +2466,14 @@ void ChainedFixupsSection::finalizeContents() {
   else
     importFormat = DYLD_CHAINED_IMPORT;
 
-  for (Location &loc : locations)
+  // There is one location per fixup, which can be millions for large
+  // binaries, so compute and sort their segment offsets in parallel.
+  parallelForEach(locations, [](Location &loc) {
     loc.offset =
         loc.isec->parent->getSegmentOffset() + loc.isec->getOffset(loc.offset);
+  });
 
-  llvm::sort(locations, [](const Location &a, const Location &b) {
+  parallelSort(locations, [](const Location &a, const Location &b) {
     const OutputSegment *segA = a.isec->parent->parent;
     const OutputSegment *segB = b.isec->parent->parent;
     if (segA == segB)
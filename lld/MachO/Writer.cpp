@@ -1222,21 +1222,34 @@ void Writer::buildFixupChains() {
   const uint64_t pageSize = target->getPageSize();
   constexpr uint32_t stride = 4; // for DYLD_CHAINED_PTR_64
 
-  for (size_t i = 0, count = loc.size(); i < count;) {
+  // Each page has its own chain, so find where the pages start and link the
+  // fixups of different pages in parallel.
+  auto samePage = [&](const Location &a, const Location &b) {
+    return a.isec->parent->parent == b.isec->parent->parent &&
+           a.offset / pageSize == b.offset / pageSize;
+  };
+  SmallVector<size_t, 0> pageBegins;
+  for (size_t i = 0, count = loc.size(); i < count; ++i)
+    if (i == 0 || !samePage(loc[i - 1], loc[i]))
+      pageBegins.push_back(i);
+  pageBegins.push_back(loc.size());
+
+  auto linkPage = [&](size_t page) -> Error {
+    size_t i = pageBegins[page];
+    const size_t end = pageBegins[page + 1];
     const OutputSegment *oseg = loc[i].isec->parent->parent;
     uint8_t *buf = buffer->getBufferStart() + oseg->fileOff;
-    uint64_t pageIdx = loc[i].offset / pageSize;
     ++i;
 
-    while (i < count && loc[i].isec->parent->parent == oseg &&
-           (loc[i].offset / pageSize) == pageIdx) {
+    while (i < end) {
       uint64_t offset = loc[i].offset - loc[i - 1].offset;
 
       auto fail = [&](Twine message) {
-        error(loc[i].isec->getSegName() + "," + loc[i].isec->getName() +
-              ", offset " +
-              Twine(loc[i].offset - loc[i].isec->parent->getSegmentOffset()) +
-              ": " + message);
+        return createStringError(
+            loc[i].isec->getSegName() + "," + loc[i].isec->getName() +
+            ", offset " +
+            Twine(loc[i].offset - loc[i].isec->parent->getSegmentOffset()) +
+            ": " + message);
       };
 
       if (offset < target->wordSize)
@@ -1251,7 +1264,11 @@ void Writer::buildFixupChains() {
           ->next = offset / stride;
       ++i;
     }
-  }
+    return Error::success();
+  };
+  // As in a serial pass, only the first invalid fixup is reported.
+  if (Error err = parallelForFirstError(0, pageBegins.size() - 1, linkPage))
+    error(toString(std::move(err)));
 }
 
 void Writer::writeCodeSignature() {
@@ -79,9 +79,10 @@ void CodeSection::writeTo(uint8_t *buf) {
   // Write code section headers
   memcpy(buf, codeSectionHeader.data(), codeSectionHeader.size());
 
-  // Write code section bodies
-  for (const InputChunk *chunk : functions)
-    chunk->writeTo(buf);
+  // Write code section bodies. Every function has a fixed output offset, so
+  // they can be copied and relocated independently.
+  parallelForEach(functions,
+                  [buf](const InputChunk *chunk) { chunk->writeTo(buf); });
 }
 
 uint32_t CodeSection::getNumRelocations() const {
@@ -184,8 +185,8 @@ void DataSection::writeTo(uint8_t *buf) {
     memcpy(segStart, segment->header.data(), segment->header.size());
 
     // Write segment data payload
-    for (const InputChunk *chunk : segment->inputSegments)
-      chunk->writeTo(buf);
+    parallelForEach(segment->inputSegments,
+                    [buf](const InputChunk *chunk) { chunk->writeTo(buf); });
   }
 }
 
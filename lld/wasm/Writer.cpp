@@ -219,10 +219,21 @@ void Writer::writeHeader() {
 
 void Writer::writeSections() {
   uint8_t *buf = buffer->getBufferStart();
-  parallelForEach(outputSections, [buf](OutputSection *s) {
+
+  // The code and data sections write their chunks in parallel themselves.
+  // Nested parallel loops run serially, so write those two after the rest
+  // instead of from within the loop over all sections.
+  auto writesChunksInParallel = [](OutputSection *s) {
+    return isa<CodeSection>(s) || isa<DataSection>(s);
+  };
+  parallelForEach(outputSections, [&](OutputSection *s) {
     assert(s->isNeeded());
-    s->writeTo(buf);
+    if (!writesChunksInParallel(s))
+      s->writeTo(buf);
   });
+  for (OutputSection *s : outputSections)
+    if (writesChunksInParallel(s))
+      s->writeTo(buf);
 }
 
 // Computes a hash value of Data using a given hash function.
@@ -414,6 +414,13 @@ public:
   /// hasn't been indexed yet, or a valid duration if it has.
   virtual StatsDuration::Duration GetDebugInfoIndexTime() { return {}; }
 
+  /// Return the time spent completing forward declared types from the debug
+  /// information.
+  ///
+  /// \returns 0.0 if no types have been completed or if the symbol file
+  /// doesn't track this.
+  virtual StatsDuration::Duration GetTypeCompletionTime() { return {}; }
+
   /// Get the additional modules that this symbol file uses to parse debug info.
   ///
   /// Some debug info is stored in stand alone object files that are represented
@@ -181,6 +181,7 @@ public:
   uint64_t GetDebugInfoSize(bool load_all_debug_info = false) override;
   lldb_private::StatsDuration::Duration GetDebugInfoParseTime() override;
   lldb_private::StatsDuration::Duration GetDebugInfoIndexTime() override;
+  lldb_private::StatsDuration::Duration GetTypeCompletionTime() override;
 
   uint32_t GetAbilities() override;
 
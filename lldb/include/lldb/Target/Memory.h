@@ -57,6 +57,7 @@ protected:
   InvalidRanges m_invalid_ranges;
   Process &m_process;
   uint32_t m_L2_cache_line_byte_size;
+  uint64_t m_L2_prefetch_lines;
 
 private:
   MemoryCache(const MemoryCache &) = delete;
@@ -82,6 +82,8 @@ public:
 
   bool GetDisableMemoryCache() const;
   uint64_t GetMemoryCacheLineSize() const;
+  uint64_t GetMemoryCachePrefetchLines() const;
+  void SetMemoryCachePrefetchLines(uint64_t lines);
   Args GetExtraStartupCommands() const;
   void SetExtraStartupCommands(const Args &args);
   FileSpec GetPythonOSPluginPath() const;
@@ -121,8 +121,17 @@ void ManualDWARFIndex::Index() {
 
   auto finalize_fn = [this, &sets, &progress](NameToDIE(IndexSet::*index)) {
     NameToDIE &result = m_set.*index;
+    // Size the result up front so that it doesn't have to grow while merging,
+    // and release each unit's map as soon as it was merged. Otherwise the
+    // peak memory use is a multiple of the size of the final index.
+    size_t total = result.GetSize();
     for (auto &set : sets)
+      total += (set.*index).GetSize();
+    result.Reserve(total);
+    for (auto &set : sets) {
       result.Append(set.*index);
+      set.*index = NameToDIE();
+    }
     result.Finalize();
     progress.Increment();
   };
@@ -12,6 +12,7 @@
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/FileUtilities.h"
 #include "llvm/Support/Format.h"
+#include "llvm/Support/SaveAndRestore.h"
 #include "llvm/Support/Threading.h"
 
 #include "lldb/Core/Module.h"
@@ -1611,6 +1612,12 @@ bool SymbolFileDWARF::HasForwardDeclForCompilerType(
 
 bool SymbolFileDWARF::CompleteType(CompilerType &compiler_type) {
   std::lock_guard<std::recursive_mutex> guard(GetModuleMutex());
+  // Completing a class completes the types it depends on recursively, so only
+  // time the outermost call.
+  std::optional<ElapsedTime> elapsed;
+  if (m_complete_type_depth == 0)
+    elapsed.emplace(m_type_completion_time);
+  llvm::SaveAndRestore depth(m_complete_type_depth, m_complete_type_depth + 1);
   auto clang_type_system =
       compiler_type.GetTypeSystem().dyn_cast_or_null<TypeSystemClang>();
   if (clang_type_system) {
@@ -315,6 +315,9 @@ public:
     return m_parse_time;
   }
   StatsDuration::Duration GetDebugInfoIndexTime() override;
+  StatsDuration::Duration GetTypeCompletionTime() override {
+    return m_type_completion_time;
+  }
 
   StatsDuration &GetDebugInfoParseTimeRef() { return m_parse_time; }
 
@@ -551,6 +554,10 @@ protected:
   /// address in the module.
   lldb::addr_t m_first_code_address = LLDB_INVALID_ADDRESS;
   StatsDuration m_parse_time;
+  StatsDuration m_type_completion_time;
+  /// The nesting depth of CompleteType() calls, which is protected by the
+  /// module mutex. Only the outermost call is timed.
+  uint32_t m_complete_type_depth = 0;
   std::atomic_flag m_dwo_warning_issued = ATOMIC_FLAG_INIT;
   /// If this DWARF file a .DWO file or a DWARF .o file on mac when
   /// no dSYM file is being used, this file index will be set to a
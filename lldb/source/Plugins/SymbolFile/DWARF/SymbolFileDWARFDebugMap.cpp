@@ -1541,6 +1541,17 @@ ModuleList SymbolFileDWARFDebugMap::GetDebugInfoModules() {
   return oso_modules;
 }
 
+StatsDuration::Duration SymbolFileDWARFDebugMap::GetTypeCompletionTime() {
+  // Types are completed by the .o file symbol files, so report the time they
+  // spent.
+  StatsDuration::Duration elapsed(0.0);
+  ForEachSymbolFile([&](SymbolFileDWARF *oso_dwarf) {
+    elapsed += oso_dwarf->GetTypeCompletionTime();
+    return IterationAction::Continue;
+  });
+  return elapsed;
+}
+
 Status SymbolFileDWARFDebugMap::CalculateFrameVariableError(StackFrame &frame) {
   std::lock_guard<std::recursive_mutex> guard(GetModuleMutex());
 
@@ -140,6 +140,7 @@ public:
 
   // Statistics overrides.
   ModuleList GetDebugInfoModules() override;
+  StatsDuration::Duration GetTypeCompletionTime() override;
 
   void
   GetCompileOptions(std::unordered_map<lldb::CompUnitSP, Args> &args) override;
@@ -14,6 +14,7 @@
 #include "TraceIntelPTJSONStructs.h"
 #include "lldb/Core/Debugger.h"
 #include "lldb/Core/Module.h"
+#include "lldb/Core/ModuleList.h"
 #include "lldb/Target/Process.h"
 #include "lldb/Target/ProcessTrace.h"
 #include "lldb/Target/Target.h"
@@ -132,6 +133,12 @@ TraceIntelPTBundleLoader::ParseProcess(const JSONProcess &process) {
     if (Error err = ParseModule(*parsed_process->target_sp, module))
       return std::move(err);
 
+  // The modules were added without notification, so announce them all at
+  // once, which also preloads their symbols in parallel. The target was just
+  // created, so its images are exactly the modules of the bundle.
+  ModuleList modules = parsed_process->target_sp->GetImages();
+  parsed_process->target_sp->ModulesDidLoad(modules);
+
   if (!process.threads.empty())
     process_sp->GetThreadList().SetSelectedThreadByIndexID(0);
 
@@ -184,6 +191,11 @@ TraceIntelPTBundleLoader::ParseKernel(
   module_sp->SetLoadAddress(*parsed_process->target_sp, load_address, false,
                             load_addr_changed);
 
+  // The kernel image was added without notification.
+  ModuleList modules;
+  modules.Append(module_sp);
+  parsed_process->target_sp->ModulesDidLoad(modules);
+
   process_sp->GetThreadList().SetSelectedThreadByIndexID(0);
 
   // We invoke DidAttach to create a correct stopped state for the process and
@@ -24,7 +24,8 @@ using namespace lldb_private;
 MemoryCache::MemoryCache(Process &process)
     : m_mutex(), m_L1_cache(), m_L2_cache(), m_invalid_ranges(),
       m_process(process),
-      m_L2_cache_line_byte_size(process.GetMemoryCacheLineSize()) {}
+      m_L2_cache_line_byte_size(process.GetMemoryCacheLineSize()),
+      m_L2_prefetch_lines(process.GetMemoryCachePrefetchLines()) {}
 
 // Destructor
 MemoryCache::~MemoryCache() = default;
@@ -36,6 +37,7 @@ void MemoryCache::Clear(bool clear_invalid_ranges) {
   if (clear_invalid_ranges)
     m_invalid_ranges.Clear();
   m_L2_cache_line_byte_size = m_process.GetMemoryCacheLineSize();
+  m_L2_prefetch_lines = m_process.GetMemoryCachePrefetchLines();
 }
 
 void MemoryCache::AddL1CacheData(lldb::addr_t addr, const void *src,
@@ -133,6 +135,42 @@ lldb::DataBufferSP MemoryCache::GetL2CacheLine(lldb::addr_t line_base_addr,
   if (pos != m_L2_cache.end())
     return pos->second;
 
+  // If the line before this one is cached, memory is likely being read line
+  // after line, as when unwinding the stack. Read the following lines with the
+  // same request to save round trips to the inferior.
+  const addr_t line_size = m_L2_cache_line_byte_size;
+  uint64_t num_lines = 1;
+  if (m_L2_prefetch_lines > 0 && line_base_addr >= line_size &&
+      m_L2_cache.count(line_base_addr - line_size)) {
+    while (num_lines <= m_L2_prefetch_lines) {
+      addr_t next_line_addr = line_base_addr + num_lines * line_size;
+      if (next_line_addr < line_base_addr ||
+          m_L2_cache.count(next_line_addr) ||
+          m_invalid_ranges.FindEntryThatContains(next_line_addr))
+        break;
+      ++num_lines;
+    }
+  }
+  if (num_lines > 1) {
+    std::vector<uint8_t> buffer(num_lines * line_size);
+    Status prefetch_error;
+    size_t process_bytes_read = m_process.ReadMemoryFromInferior(
+        line_base_addr, buffer.data(), buffer.size(), prefetch_error);
+    // Only keep complete lines. If not even the requested line was read
+    // completely, read just that line below.
+    if (process_bytes_read >= line_size) {
+      lldb::DataBufferSP first_line_sp;
+      for (uint64_t i = 0; (i + 1) * line_size <= process_bytes_read; ++i) {
+        auto line_sp = std::make_shared<DataBufferHeap>(
+            buffer.data() + i * line_size, line_size);
+        m_L2_cache[line_base_addr + i * line_size] = line_sp;
+        if (i == 0)
+          first_line_sp = line_sp;
+      }
+      return first_line_sp;
+    }
+  }
+
   auto data_buffer_heap_sp =
       std::make_shared<DataBufferHeap>(m_L2_cache_line_byte_size, 0);
   size_t process_bytes_read = m_process.ReadMemoryFromInferior(
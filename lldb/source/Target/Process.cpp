@@ -225,6 +225,17 @@ uint64_t ProcessProperties::GetMemoryCacheLineSize() const {
       idx, g_process_properties[idx].default_uint_value);
 }
 
+uint64_t ProcessProperties::GetMemoryCachePrefetchLines() const {
+  const uint32_t idx = ePropertyMemCachePrefetchLines;
+  return GetPropertyAtIndexAs<uint64_t>(
+      idx, g_process_properties[idx].default_uint_value);
+}
+
+void ProcessProperties::SetMemoryCachePrefetchLines(uint64_t lines) {
+  const uint32_t idx = ePropertyMemCachePrefetchLines;
+  SetPropertyAtIndex(idx, lines);
+}
+
 Args ProcessProperties::GetExtraStartupCommands() const {
   Args args;
   const uint32_t idx = ePropertyExtraStartCommand;
@@ -66,6 +66,7 @@
 
 #include "llvm/ADT/ScopeExit.h"
 #include "llvm/ADT/SetVector.h"
+#include "llvm/Support/ThreadPool.h"
 
 #include <memory>
 #include <mutex>
@@ -1690,6 +1691,20 @@ void Target::NotifyModulesRemoved(lldb_private::ModuleList &module_list) {
 void Target::ModulesDidLoad(ModuleList &module_list) {
   const size_t num_images = module_list.GetSize();
   if (m_valid && num_images) {
+    // Modules added with GetOrCreateModule(..., /*notify=*/false) haven't had
+    // their symbols preloaded yet. Parsing the symbol tables and indexing the
+    // debug info of the modules is independent, so do it in parallel before
+    // the breakpoint updates below need it. Preloading is a no-op for modules
+    // that were already preloaded.
+    if (GetPreloadSymbols()) {
+      llvm::ThreadPoolTaskGroup task_group(Debugger::GetThreadPool());
+      for (size_t idx = 0; idx < num_images; ++idx)
+        task_group.async([module_sp = module_list.GetModuleAtIndex(idx)] {
+          if (module_sp)
+            module_sp->PreloadSymbols();
+        });
+      task_group.wait();
+    }
     for (size_t idx = 0; idx < num_images; ++idx) {
       ModuleSP module_sp(module_list.GetModuleAtIndex(idx));
       LoadScriptingResourceForModule(module_sp, this);
@@ -2312,8 +2327,9 @@ ModuleSP Target::GetOrCreateModule(const ModuleSpec &module_spec, bool notify,
           module_sp->SetSymbolFileFileSpec(symbol_file_spec);
 
         // Preload symbols outside of any lock, so hopefully we can do this for
-        // each library in parallel.
-        if (GetPreloadSymbols())
+        // each library in parallel. If the caller is adding several modules,
+        // ModulesDidLoad() preloads all of them in parallel instead.
+        if (notify && GetPreloadSymbols())
           module_sp->PreloadSymbols();
         llvm::SmallVector<ModuleSP, 1> replaced_modules;
         for (ModuleSP &old_module_sp : old_modules) {
@@ -0,0 +1,44 @@
+"""
+Test that statistics dump reports type completion time for an executable whose
+debug info is read from its .o files through a debug map.
+"""
+
+import json
+import os
+
+import lldb
+from lldbsuite.test.decorators import *
+from lldbsuite.test.lldbtest import *
+from lldbsuite.test import lldbutil
+
+
+class TestStatsDebugMap(TestBase):
+    NO_DEBUG_INFO_TESTCASE = True
+
+    def get_stats(self):
+        return_obj = lldb.SBCommandReturnObject()
+        self.ci.HandleCommand("statistics dump", return_obj, False)
+        self.assertTrue(return_obj.Succeeded())
+        return json.loads(return_obj.GetOutput())
+
+    @skipUnlessDarwin
+    def test_type_completion_time(self):
+        # Without a dSYM, SymbolFileDWARFDebugMap reads the DWARF from the .o
+        # files and the types are completed by their symbol files.
+        self.build(debug_info="dwarf")
+        exe = self.getBuildArtifact("a.out")
+        lldbutil.run_to_source_breakpoint(
+            self, "// break here", lldb.SBFileSpec("main.cpp")
+        )
+        self.expect_expr("outer.inner.value", result_value="2")
+
+        stats = self.get_stats()
+        exe_stats = [
+            module
+            for module in stats["modules"]
+            if os.path.realpath(module["path"]) == os.path.realpath(exe)
+        ]
+        self.assertEqual(len(exe_stats), 1)
+        self.assertIn("symbolFileModuleIdentifiers", exe_stats[0])
+        self.assertGreater(exe_stats[0]["typeCompletionTime"], 0.0)
+        self.assertGreater(stats["totalTypeCompletionTime"], 0.0)
@@ -0,0 +1,13 @@
+struct Inner {
+  int value;
+};
+
+struct Outer {
+  int first;
+  Inner inner;
+};
+
+int main() {
+  Outer outer = {1, {2}};
+  return outer.first; // break here
+}
@@ -226,3 +226,57 @@ TEST_F(MemoryTest, TesetMemoryCacheRead) {
                                                        // instead of using an
                                                        // old cache
 }
+
+TEST_F(MemoryTest, TestMemoryCachePrefetch) {
+  ArchSpec arch("x86_64-apple-macosx-");
+
+  Platform::SetHostPlatform(PlatformRemoteMacOSX::CreateInstance(true, &arch));
+
+  DebuggerSP debugger_sp = Debugger::CreateInstance();
+  ASSERT_TRUE(debugger_sp);
+
+  TargetSP target_sp = CreateTarget(debugger_sp, arch);
+  ASSERT_TRUE(target_sp);
+
+  ListenerSP listener_sp(Listener::MakeListener("dummy"));
+  ProcessSP process_sp = std::make_shared<DummyProcess>(target_sp, listener_sp);
+  ASSERT_TRUE(process_sp);
+
+  DummyProcess *process = static_cast<DummyProcess *>(process_sp.get());
+  process->SetMemoryCachePrefetchLines(2);
+  MemoryCache &mem_cache = process->GetMemoryCache();
+  mem_cache.Clear();
+  const uint64_t l2_cache_size = process->GetMemoryCacheLineSize();
+  Status error;
+  auto data_sp = std::make_shared<DataBufferHeap>(l2_cache_size, '\0');
+  size_t bytes_read = 0;
+
+  // The first line is read on its own.
+  process->SetMaxReadSize(l2_cache_size * 8);
+  bytes_read = mem_cache.Read(0x1000, data_sp->GetBytes(),
+                              data_sp->GetByteSize(), error);
+  ASSERT_EQ(bytes_read, l2_cache_size);
+  ASSERT_EQ(process->m_bytes_left, l2_cache_size * 7);
+
+  // Reading the next line reads two more lines ahead.
+  bytes_read = mem_cache.Read(0x1000 + l2_cache_size, data_sp->GetBytes(),
+                              data_sp->GetByteSize(), error);
+  ASSERT_EQ(bytes_read, l2_cache_size);
+  ASSERT_EQ(process->m_bytes_left, l2_cache_size * 4);
+
+  // The lines read ahead are served from the cache.
+  for (uint64_t i = 2; i < 4; ++i) {
+    bytes_read = mem_cache.Read(0x1000 + i * l2_cache_size,
+                                data_sp->GetBytes(), data_sp->GetByteSize(),
+                                error);
+    ASSERT_EQ(bytes_read, l2_cache_size);
+  }
+  ASSERT_EQ(process->m_bytes_left, l2_cache_size * 4);
+
+  // Reading ahead stops at cached lines and invalid ranges.
+  mem_cache.AddInvalidRange(0x1000 + l2_cache_size * 6, l2_cache_size);
+  bytes_read = mem_cache.Read(0x1000 + l2_cache_size * 4, data_sp->GetBytes(),
+                              data_sp->GetByteSize(), error);
+  ASSERT_EQ(bytes_read, l2_cache_size);
+  ASSERT_EQ(process->m_bytes_left, l2_cache_size * 2);
+}
@@ -0,0 +1,33 @@
+#include "benchmark/benchmark.h"
+#include "llvm/Support/xxhash.h"
+#include <vector>
+
+static std::vector<uint8_t> makeInput(size_t Size) {
+  std::vector<uint8_t> Data(Size);
+  uint64_t X = 1;
+  for (uint8_t &Byte : Data) {
+    X ^= X << 13;
+    X ^= X >> 7;
+    X ^= X << 17;
+    Byte = uint8_t(X);
+  }
+  return Data;
+}
+
+static void BM_xxh3_64bits(benchmark::State &State) {
+  std::vector<uint8_t> Data = makeInput(State.range(0));
+  for (auto _ : State)
+    benchmark::DoNotOptimize(llvm::xxh3_64bits(Data));
+  State.SetBytesProcessed(int64_t(State.iterations()) * State.range(0));
+}
+BENCHMARK(BM_xxh3_64bits)->RangeMultiplier(16)->Range(16, 16 << 20);
+
+static void BM_xxh3_128bits(benchmark::State &State) {
+  std::vector<uint8_t> Data = makeInput(State.range(0));
+  for (auto _ : State)
+    benchmark::DoNotOptimize(llvm::xxh3_128bits(Data));
+  State.SetBytesProcessed(int64_t(State.iterations()) * State.range(0));
+}
+BENCHMARK(BM_xxh3_128bits)->RangeMultiplier(16)->Range(16, 16 << 20);
+
+BENCHMARK_MAIN();
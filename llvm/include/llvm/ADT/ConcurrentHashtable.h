@@ -223,6 +223,55 @@ public:
     return {};
   }
 
+  /// Look up the entry for \p Key without inserting it. Safe to call
+  /// concurrently with insert(). Entries are never moved, so the caller may
+  /// update the returned entry in place, provided it synchronizes with other
+  /// threads accessing the same entry.
+  ///
+  /// \returns the entry, or nullptr if there is none.
+  KeyDataTy *find(const KeyTy &Key) {
+    uint64_t Hash = Info::getHashValue(Key);
+    Bucket &CurBucket = BucketsArray[getBucketIdx(Hash)];
+    uint32_t ExtHashBits = getExtHashBits(Hash);
+
+#if LLVM_ENABLE_THREADS
+    std::lock_guard<std::mutex> Lock(CurBucket.Guard);
+#endif
+
+    HashesPtr BucketHashes = CurBucket.Hashes;
+    DataPtr BucketEntries = CurBucket.Entries;
+    uint32_t CurEntryIdx = getStartIdx(ExtHashBits, CurBucket.Size);
+
+    // Buckets are rehashed before they become full, so there always is an
+    // empty slot to stop at.
+    while (true) {
+      uint32_t CurEntryHashBits = BucketHashes[CurEntryIdx];
+      KeyDataTy *EntryData = BucketEntries[CurEntryIdx];
+
+      if (CurEntryHashBits == 0 && EntryData == nullptr)
+        return nullptr;
+
+      if (CurEntryHashBits == ExtHashBits &&
+          Info::isEqual(Info::getKey(*EntryData), Key))
+        return EntryData;
+
+      CurEntryIdx++;
+      CurEntryIdx &= (CurBucket.Size - 1);
+    }
+  }
+
+  /// Call \p Fn for every entry, in unspecified order. This does not take
+  /// the bucket locks; it must not run concurrently with insert(), e.g. it is
+  /// meant to be used after the parallel phase filling the table finished.
+  void forEach(function_ref<void(KeyDataTy &)> Fn) {
+    for (uint32_t Idx = 0; Idx < NumberOfBuckets; Idx++) {
+      Bucket &CurBucket = BucketsArray[Idx];
+      for (uint32_t EntryIdx = 0; EntryIdx < CurBucket.Size; EntryIdx++)
+        if (KeyDataTy *EntryData = CurBucket.Entries[EntryIdx])
+          Fn(*EntryData);
+    }
+  }
+
   /// Print information about current state of hash table structures.
   void printStatistic(raw_ostream &OS) {
     OS << "\n--- HashTable statistic:\n";
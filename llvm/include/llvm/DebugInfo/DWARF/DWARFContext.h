@@ -146,6 +146,9 @@ public:
 
   const DWARFObject &getDWARFObj() const { return *DObj; }
 
+  /// Return true if the context was created to be used from several threads.
+  bool isThreadSafe() const { return State->isThreadSafe(); }
+
   static bool classof(const DIContext *DICtx) {
     return DICtx->getKind() == CK_DWARF;
   }
@@ -27,6 +27,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <utility>
 #include <vector>
@@ -241,6 +242,11 @@ class DWARFUnit {
   std::optional<object::SectionedAddress> BaseAddr;
   /// The compile unit debug information entry items.
   std::vector<DWARFDebugInfoEntry> DieArray;
+  /// Serializes extracting and clearing DieArray in a thread-safe context, so
+  /// that different threads can parse different units of the same context
+  /// concurrently. It is recursive because extraction looks at the unit DIE it
+  /// just parsed.
+  std::recursive_mutex DieArrayMutex;
 
   /// Map from range's start address to end address and corresponding DIE.
   /// IntervalMap does not support range removal, as a result, we use the
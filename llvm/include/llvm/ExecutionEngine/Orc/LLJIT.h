@@ -320,6 +320,7 @@ public:
   ProcessSymbolsJITDylibSetupFunction SetupProcessSymbolsJITDylib;
   ObjectLinkingLayerCreator CreateObjectLinkingLayer;
   CompileFunctionCreator CreateCompileFunction;
+  ObjectCache *ObjCache = nullptr;
   unique_function<Error(LLJIT &)> PrePlatformSetup;
   PlatformSetupFunction SetUpPlatform;
   NotifyCreatedFunction NotifyCreated;
@@ -421,6 +422,18 @@ public:
     return impl();
   }
 
+  /// Set an ObjectCache for the default compile function to query before
+  /// compiling a module, and to notify of each object it compiles.
+  ///
+  /// The cache is keyed by the module (see ObjectCache), so a cache that
+  /// persists objects across processes lets later runs skip code generation
+  /// for modules that haven't changed. The cache must outlive the LLJIT
+  /// instance. This has no effect if a CompileFunctionCreator is set.
+  SetterImpl &setObjectCache(ObjectCache *ObjCache) {
+    impl().ObjCache = ObjCache;
+    return impl();
+  }
+
   /// Set a setup function to be run just before the PlatformSetupFunction is
   /// run.
   ///
@@ -72,14 +72,16 @@ private:
 
   void launchCompile(ExecutorAddr FAddr) {
     SymbolNameSet CandidateSet;
-    // Copy CandidateSet is necessary, to avoid unsynchronized access to
-    // the datastructure.
+    // Take CandidateSet out of the map to avoid unsynchronized access to the
+    // datastructure. The speculation guard emitted by IRSpeculationLayer makes
+    // each function speculate only once, so the entry is not needed again.
     {
       std::lock_guard<std::mutex> Lockit(ConcurrentAccess);
       auto It = GlobalSpecMap.find(FAddr);
       if (It == GlobalSpecMap.end())
         return;
-      CandidateSet = It->getSecond();
+      CandidateSet = std::move(It->getSecond());
+      GlobalSpecMap.erase(It);
     }
 
     SymbolDependenceMap SpeculativeLookUpImpls;
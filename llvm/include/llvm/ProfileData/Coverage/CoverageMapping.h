@@ -938,6 +938,23 @@ class CoverageMapping {
       ArrayRef<std::unique_ptr<CoverageMappingReader>> CoverageReaders,
       IndexedInstrProfReader &ProfileReader, CoverageMapping &Coverage);
 
+  // The coverage mapping readers of an object file and the buffers they read
+  // from.
+  struct ObjectReaders;
+
+  // Read the coverage mapping of an object file. This only touches the file
+  // itself, so several files can be read concurrently.
+  static Expected<ObjectReaders> readObject(StringRef Filename, StringRef Arch,
+                                            StringRef CompilationDir,
+                                            bool CollectBinaryIDs);
+
+  // Load coverage records from the readers of an object file.
+  static Error
+  loadFromObject(StringRef Filename, ObjectReaders &Object,
+                 IndexedInstrProfReader &ProfileReader,
+                 CoverageMapping &Coverage, bool &DataFound,
+                 SmallVectorImpl<object::BuildID> *FoundBinaryIDs);
+
   // Load coverage records from file.
   static Error
   loadFromFile(StringRef Filename, StringRef Arch, StringRef CompilationDir,
@@ -968,12 +985,15 @@ public:
   /// Load the coverage mapping from the given object files and profile. If
   /// \p Arches is non-empty, it must specify an architecture for each object.
   /// Ignores non-instrumented object files unless all are not instrumented.
+  /// The object files are read on up to \p NumThreads threads, where 0 means
+  /// one per hardware thread; the records are still loaded in the order of
+  /// \p ObjectFilenames.
   static Expected<std::unique_ptr<CoverageMapping>>
   load(ArrayRef<StringRef> ObjectFilenames, StringRef ProfileFilename,
        vfs::FileSystem &FS, ArrayRef<StringRef> Arches = std::nullopt,
        StringRef CompilationDir = "",
        const object::BuildIDFetcher *BIDFetcher = nullptr,
-       bool CheckBinaryIDs = false);
+       bool CheckBinaryIDs = false, unsigned NumThreads = 1);
 
   /// The number of functions that couldn't have their profiles mapped.
   ///
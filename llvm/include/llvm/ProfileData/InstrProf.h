@@ -174,6 +174,12 @@ inline StringRef getInstrProfCounterBiasVarName() {
   return INSTR_PROF_QUOTE(INSTR_PROF_PROFILE_COUNTER_BIAS_VAR);
 }
 
+/// Return the name of the runtime flag that guards counter updates in sampled
+/// instrumentation.
+inline StringRef getInstrProfSamplingVarName() {
+  return "__llvm_profile_sampling";
+}
+
 /// Return the marker used to separate PGO names during serialization.
 inline StringRef getInstrProfNameSeparator() { return "\01"; }
 
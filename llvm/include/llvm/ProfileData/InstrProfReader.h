@@ -699,6 +699,11 @@ private:
   StringRef VTableName;
   /// A memory buffer holding binary ids.
   ArrayRef<uint8_t> BinaryIdsBuffer;
+  /// The serialized temporal profile traces. They are only needed by tools,
+  /// so they are decoded on the first call to getTemporalProfTraces() rather
+  /// than in readHeader().
+  const unsigned char *TemporalProfTracesStart = nullptr;
+  uint64_t NumTemporalProfTraces = 0;
 
   // Index to the current record in the record array.
   unsigned RecordIndex = 0;
@@ -709,6 +714,10 @@ private:
   const unsigned char *readSummary(IndexedInstrProf::ProfVersion Version,
                                    const unsigned char *Cur, bool UseCS);
 
+  // Decode the temporal profile traces located and bounds-checked by
+  // readHeader().
+  void readTemporalProfTraces();
+
 public:
   IndexedInstrProfReader(
       std::unique_ptr<MemoryBuffer> DataBuffer,
@@ -755,6 +764,10 @@ public:
   /// Read a single record.
   Error readNextRecord(NamedInstrProfRecord &Record) override;
 
+  /// Decode the temporal profile traces on first use.
+  SmallVector<TemporalProfTraceTy> &
+  getTemporalProfTraces(std::optional<uint64_t> Weight = {}) override;
+
   /// Return the NamedInstrProfRecord associated with FuncName and FuncHash.
   /// When return a hash_mismatch error and MismatchedFuncSum is not nullptr,
   /// the sum of all counters in the mismatched function will be set to
@@ -50,6 +50,11 @@ private:
   getOrEmplace(uint32_t Index, GlobalValue::GUID G,
                SmallVectorImpl<uint64_t> &&Counters);
 
+  /// Check that merge() can combine \p Other into this context, so that a
+  /// failed merge leaves this context unchanged.
+  Error checkMergeable(const PGOContextualProfile &Other) const;
+  void mergeChecked(PGOContextualProfile &&Other);
+
 public:
   PGOContextualProfile(const PGOContextualProfile &) = delete;
   PGOContextualProfile &operator=(const PGOContextualProfile &) = delete;
@@ -70,6 +75,13 @@ public:
     return Callsites.find(I)->second;
   }
   void getContainedGuids(DenseSet<GlobalValue::GUID> &Guids) const;
+
+  /// Add the counters of \p Other, which must describe the same function,
+  /// to this context, recursively merging the callee contexts. Counters
+  /// saturate instead of overflowing. This is used to combine profiles
+  /// collected on different hosts for the same root. On error, this context
+  /// is left unchanged.
+  Error merge(PGOContextualProfile &&Other);
 };
 
 class PGOCtxProfileReader final {
@@ -34,6 +34,16 @@ public:
     /// Don't use mmap and instead write an in-memory buffer to a file when this
     /// buffer is closed.
     F_no_mmap = 2,
+
+    /// If the destination is an existing regular file of exactly the
+    /// requested size, keep it in place and on commit() rewrite only the
+    /// pages whose contents changed. Unchanged pages are never dirtied, which
+    /// makes relinking a large output with few changes much cheaper. The file
+    /// is replaced as usual instead if it has other hard links, is open or
+    /// mapped by anyone else, or this cannot be checked (currently anywhere
+    /// but Linux). Unlike the default mode, the update is not atomic: a crash
+    /// during commit() leaves a partially updated file.
+    F_update_in_place = 4,
   };
 
   /// Factory method to create an OutputBuffer object which manages a read/write
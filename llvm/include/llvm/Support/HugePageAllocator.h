@@ -0,0 +1,77 @@
+//===- llvm/Support/HugePageAllocator.h - Huge page slab allocator -*- C++ -*-//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+/// \file
+///
+/// This file defines HugePageAllocator, an allocator that maps its blocks
+/// directly from the operating system and asks for them to be backed by huge
+/// pages. It is meant to provide the slabs of large, long-lived
+/// BumpPtrAllocators, where the TLB misses of small pages show up in
+/// profiles. It is too expensive to serve small allocations directly.
+///
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_HUGEPAGEALLOCATOR_H
+#define LLVM_SUPPORT_HUGEPAGEALLOCATOR_H
+
+#include "llvm/Support/Allocator.h"
+#include "llvm/Support/AllocatorBase.h"
+#include "llvm/Support/Compiler.h"
+#include <cstddef>
+
+namespace llvm {
+
+/// Blocks mapped by this allocator count towards its statistics, which makes
+/// it possible to measure the footprint of several BumpPtrAllocators sharing
+/// one instance through BumpPtrAllocatorImpl<HugePageAllocator &, ...>.
+class HugePageAllocator : public AllocatorBase<HugePageAllocator> {
+public:
+  /// The large page size that blocks should be multiples of to be eligible
+  /// for huge pages.
+  static constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+  void Reset() {}
+
+  /// Map a block of at least \p Size bytes. \p Alignment must not exceed the
+  /// page size. Reports a fatal error if the mapping fails.
+  LLVM_ATTRIBUTE_RETURNS_NONNULL void *Allocate(size_t Size, size_t Alignment);
+
+  // Pull in base class overloads.
+  using AllocatorBase<HugePageAllocator>::Allocate;
+
+  void Deallocate(const void *Ptr, size_t Size, size_t Alignment);
+
+  // Pull in base class overloads.
+  using AllocatorBase<HugePageAllocator>::Deallocate;
+
+  /// The number of bytes currently mapped by this allocator.
+  size_t getBytesMapped() const { return BytesMapped; }
+
+  /// The largest number of bytes that were mapped at the same time.
+  size_t getPeakBytesMapped() const { return PeakBytesMapped; }
+
+  /// The number of blocks currently mapped by this allocator.
+  size_t getNumBlocks() const { return NumBlocks; }
+
+  void PrintStats() const;
+
+private:
+  size_t BytesMapped = 0;
+  size_t PeakBytesMapped = 0;
+  size_t NumBlocks = 0;
+};
+
+/// A BumpPtrAllocator whose slabs are single huge pages. Allocations larger
+/// than a slab get a custom-sized slab of their own, which is still eligible
+/// for huge pages if it is large enough.
+using HugePageBumpPtrAllocator =
+    BumpPtrAllocatorImpl<HugePageAllocator, HugePageAllocator::HugePageSize,
+                         HugePageAllocator::HugePageSize>;
+
+} // end namespace llvm
+
+#endif // LLVM_SUPPORT_HUGEPAGEALLOCATOR_H
@@ -0,0 +1,86 @@
+//===- llvm/Support/Jobserver.h - GNU make jobserver client -----*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares a client for the GNU make jobserver protocol, which lets
+// parallel tools started from a parallel build share the build's job slots
+// instead of each using every hardware thread.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_JOBSERVER_H
+#define LLVM_SUPPORT_JOBSERVER_H
+
+#include "llvm/ADT/StringRef.h"
+#include <mutex>
+#include <string>
+
+namespace llvm {
+
+/// How to reach the jobserver described by MAKEFLAGS.
+struct JobserverConfig {
+  enum ModeKind {
+    /// No usable jobserver.
+    None,
+    /// An anonymous pipe inherited through ReadFD and WriteFD.
+    Pipe,
+    /// A named pipe at Path (GNU make 4.4 and later).
+    Fifo
+  };
+  ModeKind Mode = None;
+  int ReadFD = -1;
+  int WriteFD = -1;
+  std::string Path;
+};
+
+/// Parse the jobserver options in \p MakeFlags, the value of the MAKEFLAGS
+/// environment variable. Both --jobserver-auth= and the older
+/// --jobserver-fds= spellings are accepted and, as in make, the last one wins.
+JobserverConfig parseJobserverMakeFlags(StringRef MakeFlags);
+
+/// The client side of the GNU make jobserver protocol. Every job owns one
+/// implicit slot; each additional slot is a one-byte token read from the
+/// jobserver, which has to be written back once it is no longer needed.
+class JobserverClient {
+public:
+  /// Connect to the jobserver described by \p Config. If that fails, the
+  /// client behaves as if there were no spare slots.
+  explicit JobserverClient(const JobserverConfig &Config);
+  JobserverClient(const JobserverClient &) = delete;
+  JobserverClient &operator=(const JobserverClient &) = delete;
+  /// Return all held tokens to the jobserver.
+  ~JobserverClient();
+
+  /// Return the process-wide client for the jobserver in MAKEFLAGS, or
+  /// nullptr if the process is not running under a usable jobserver. Tokens
+  /// held by it are returned on llvm_shutdown().
+  static JobserverClient *getInstance();
+
+  /// Return true if the connection to the jobserver was established.
+  bool isValid() const { return ReadFD >= 0; }
+
+  /// Return the number of slots, including the implicit one, that this
+  /// process may use, and at most \p MaxSlots. Tokens are acquired without
+  /// blocking on the first call only and held until destruction, so that all
+  /// thread pools of the process see a stable count.
+  unsigned reserveSlots(unsigned MaxSlots);
+
+private:
+  int ReadFD = -1;
+  int WriteFD = -1;
+  bool OwnsReadFD = false;
+  bool OwnsWriteFD = false;
+  bool Reserved = false;
+  /// The tokens read so far. make may hand out distinct token values, and
+  /// expects the same bytes back.
+  std::string Tokens;
+  std::mutex Mutex;
+};
+
+} // end namespace llvm
+
+#endif // LLVM_SUPPORT_JOBSERVER_H
@@ -229,6 +229,15 @@ void parallelSort(RandomAccessIterator Start, RandomAccessIterator End,
 
 void parallelFor(size_t Begin, size_t End, function_ref<void(size_t)> Fn);
 
+/// Like parallelFor, but \p Fn can fail. Every index is still visited, and the
+/// error of the lowest failing index is returned, which is the one a serial
+/// loop stopping at the first error would report. The other errors are
+/// discarded. If \p ErrorIdx is not null, it is set to the failing index, or
+/// to \p End if every call succeeded.
+Error parallelForFirstError(size_t Begin, size_t End,
+                            function_ref<Error(size_t)> Fn,
+                            size_t *ErrorIdx = nullptr);
+
 template <class IterTy, class FuncTy>
 void parallelForEach(IterTy Begin, IterTy End, FuncTy Fn) {
   parallelFor(0, End - Begin, [&](size_t I) { Fn(Begin[I]); });
@@ -129,6 +129,12 @@ constexpr bool llvm_is_multithreaded() { return LLVM_ENABLE_THREADS; }
     // threads, or hardware cores.
     bool Limit = false;
 
+    // If set, and the process runs under a GNU make jobserver (see
+    // MAKEFLAGS), use no more threads than the jobserver grants this process.
+    // Thread counts given by the user on the command line through
+    // get_threadpool_strategy() clear this.
+    bool UseJobserver = false;
+
     /// Retrieves the max available threads for the current strategy. This
     /// accounts for affinity masks and takes advantage of all CPU sockets.
     unsigned compute_thread_count() const;
@@ -163,6 +169,7 @@ constexpr bool llvm_is_multithreaded() { return LLVM_ENABLE_THREADS; }
     ThreadPoolStrategy S;
     S.UseHyperThreads = false;
     S.ThreadsRequested = ThreadCount;
+    S.UseJobserver = true;
     return S;
   }
 
@@ -185,6 +192,7 @@ constexpr bool llvm_is_multithreaded() { return LLVM_ENABLE_THREADS; }
   inline ThreadPoolStrategy hardware_concurrency(unsigned ThreadCount = 0) {
     ThreadPoolStrategy S;
     S.ThreadsRequested = ThreadCount;
+    S.UseJobserver = true;
     return S;
   }
 
@@ -94,6 +94,20 @@ struct TimeTraceProfilerEntry;
 void timeTraceProfilerInitialize(unsigned TimeTraceGranularity,
                                  StringRef ProcName);
 
+/// Limit the memory used for the recorded events of each profiler instance
+/// to about \p Bytes; 0 means no limit. Applies to instances initialized
+/// afterwards. When an instance exceeds the limit, it doubles its time
+/// granularity and drops the events that became too short, so that the
+/// longest events are kept. Totals and summaries still account for every
+/// event.
+void timeTraceProfilerSetMemoryLimit(size_t Bytes);
+
+/// Also collect the totals for each (name, detail) pair that
+/// timeTraceProfilerWriteSummary() writes. This costs time and memory for
+/// every event with a detail, so it is off by default. Applies to instances
+/// initialized afterwards.
+void timeTraceProfilerSetDetailSummary(bool Enable);
+
 /// Cleanup the time trace profiler, if it was initialized.
 void timeTraceProfilerCleanup();
 
@@ -110,6 +124,16 @@ inline bool timeTraceProfilerEnabled() {
 /// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/preview
 void timeTraceProfilerWrite(raw_pwrite_stream &OS);
 
+/// Write a compact summary of the profiling data to output stream.
+/// Instead of individual events, the summary holds the count and total time
+/// for each event name, and for each (name, detail) pair whose total is at
+/// least the time granularity, e.g. per included header or per template
+/// instantiation. Nested events with the same name and detail are counted once.
+/// The per-detail totals are only collected after
+/// timeTraceProfilerSetDetailSummary(true). Summaries from many processes can
+/// be added together.
+void timeTraceProfilerWriteSummary(raw_pwrite_stream &OS);
+
 /// Write profiling data to a file.
 /// The function will write to \p PreferredFileName if provided, if not
 /// then will write to \p FallbackFileName appending .time-trace.
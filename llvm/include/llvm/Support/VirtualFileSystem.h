@@ -17,6 +17,7 @@
 #include "llvm/ADT/IntrusiveRefCntPtr.h"
 #include "llvm/ADT/STLFunctionalExtras.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Chrono.h"
 #include "llvm/Support/Errc.h"
@@ -30,6 +31,7 @@
 #include <cstdint>
 #include <ctime>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <system_error>
@@ -481,6 +483,54 @@ private:
   virtual void anchor() override;
 };
 
+/// A file system that caches the results of \c status() and \c exists() on
+/// an underlying file system that is assumed not to change, including failed
+/// lookups. This helps workloads such as header search, where most lookups are
+/// for files that do not exist. \c openFileForRead() fails without consulting
+/// the underlying file system for paths known not to exist.
+///
+/// Entries are keyed by absolute path, so changing the working directory does
+/// not invalidate them. Changes made to the underlying file system are not
+/// seen until the affected entries are invalidated. It is safe to use from
+/// multiple threads if the underlying file system is.
+class StatCachingFileSystem
+    : public RTTIExtends<StatCachingFileSystem, ProxyFileSystem> {
+public:
+  static const char ID;
+  explicit StatCachingFileSystem(IntrusiveRefCntPtr<FileSystem> FS)
+      : RTTIExtends(std::move(FS)) {}
+
+  llvm::ErrorOr<Status> status(const Twine &Path) override;
+  bool exists(const Twine &Path) override;
+  llvm::ErrorOr<std::unique_ptr<File>>
+  openFileForRead(const Twine &Path) override;
+
+  /// Forget the cached entry for \p Path, e.g. after it was created, removed
+  /// or modified.
+  void invalidate(const Twine &Path);
+  /// Forget all cached entries.
+  void clear();
+
+  /// The number of lookups answered from the cache.
+  unsigned getNumHits() const { return NumHits; }
+  /// The number of lookups that went to the underlying file system.
+  unsigned getNumMisses() const { return NumMisses; }
+
+protected:
+  void printImpl(raw_ostream &OS, PrintType Type,
+                 unsigned IndentLevel) const override;
+
+private:
+  /// Return the cached status of the absolute path \p AbsPath, querying the
+  /// underlying file system if there is none yet.
+  llvm::ErrorOr<Status> getCachedStatus(StringRef AbsPath);
+
+  mutable std::mutex Mutex;
+  llvm::StringMap<llvm::ErrorOr<Status>> Cache;
+  unsigned NumHits = 0;
+  unsigned NumMisses = 0;
+};
+
 namespace detail {
 
 class InMemoryDirectory;
@@ -14,6 +14,7 @@
 #include "llvm/Analysis/LazyValueInfo.h"
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/AssumptionCache.h"
 #include "llvm/Analysis/ConstantFolding.h"
 #include "llvm/Analysis/InstructionSimplify.h"
@@ -34,6 +35,7 @@
 #include "llvm/IR/PatternMatch.h"
 #include "llvm/IR/ValueHandle.h"
 #include "llvm/InitializePasses.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/FormattedStream.h"
 #include "llvm/Support/KnownBits.h"
@@ -48,6 +50,16 @@ using namespace PatternMatch;
 // answer for a given value.
 static const unsigned MaxProcessedPerValue = 500;
 
+static cl::opt<unsigned> MaxCachedEntries(
+    "lvi-max-cache-entries", cl::Hidden, cl::init(0),
+    cl::desc("Flush the LVI cache at the start of a query once it holds more "
+             "than this many block values (0 = unlimited)"));
+
+STATISTIC(NumCacheHits, "Number of block value queries answered from cache");
+STATISTIC(NumCacheMisses, "Number of block value queries requiring a solve");
+STATISTIC(NumCacheFlushes, "Number of times the LVI cache was flushed for "
+                           "exceeding -lvi-max-cache-entries");
+
 char LazyValueInfoWrapperPass::ID = 0;
 LazyValueInfoWrapperPass::LazyValueInfoWrapperPass() : FunctionPass(ID) {
   initializeLazyValueInfoWrapperPassPass(*PassRegistry::getPassRegistry());
@@ -175,6 +187,9 @@ class LazyValueInfoCache {
       BlockCache;
   /// Set of value handles used to erase values from the cache on deletion.
   DenseSet<LVIValueHandle, DenseMapInfo<Value *>> ValueHandles;
+  /// Number of block values inserted since the last clear. Erasures are not
+  /// subtracted, so this is an upper bound on the current size.
+  unsigned NumInsertedResults = 0;
 
   const BlockCacheEntry *getBlockEntry(BasicBlock *BB) const {
     auto It = BlockCache.find_as(BB);
@@ -208,10 +223,16 @@ public:
       Entry->OverDefined.insert(Val);
     else
       Entry->LatticeElements.insert({Val, Result});
+    ++NumInsertedResults;
 
     addValueHandle(Val);
   }
 
+  /// Whether the cache has grown beyond -lvi-max-cache-entries.
+  bool isOverBudget() const {
+    return MaxCachedEntries && NumInsertedResults > MaxCachedEntries;
+  }
+
   std::optional<ValueLatticeElement> getCachedValueInfo(Value *V,
                                                         BasicBlock *BB) const {
     const BlockCacheEntry *Entry = getBlockEntry(BB);
@@ -245,6 +266,7 @@ public:
   void clear() {
     BlockCache.clear();
     ValueHandles.clear();
+    NumInsertedResults = 0;
   }
 
   /// Inform the cache that a given value has been deleted.
@@ -435,6 +457,16 @@ class LazyValueInfoImpl {
 
   void solve();
 
+  /// Drop all cached block values if the cache exceeds its budget. Only
+  /// called at the start of a top-level query, never while solving, so that
+  /// values on the worklist stay in the cache until they are consumed.
+  void flushCacheIfOverBudget() {
+    if (!TheCache.isOverBudget())
+      return;
+    ++NumCacheFlushes;
+    TheCache.clear();
+  }
+
   // For the following methods, if UseBlockValue is true, the function may
   // push additional values to the worklist and return nullopt. If
   // UseBlockValue is false, it will never return nullopt.
@@ -575,9 +607,11 @@ LazyValueInfoImpl::getBlockValue(Value *Val, BasicBlock *BB,
 
   if (std::optional<ValueLatticeElement> OptLatticeVal =
           TheCache.getCachedValueInfo(Val, BB)) {
+    ++NumCacheHits;
     intersectAssumeOrGuardBlockValueConstantRange(Val, *OptLatticeVal, CxtI);
     return OptLatticeVal;
   }
+  ++NumCacheMisses;
 
   // We have hit a cycle, assume overdefined.
   if (!pushBlockValue({ BB, Val }))
@@ -1518,6 +1552,7 @@ ValueLatticeElement LazyValueInfoImpl::getValueInBlock(Value *V, BasicBlock *BB,
                     << BB->getName() << "'\n");
 
   assert(BlockValueStack.empty() && BlockValueSet.empty());
+  flushCacheIfOverBudget();
   std::optional<ValueLatticeElement> OptResult = getBlockValue(V, BB, CxtI);
   if (!OptResult) {
     solve();
@@ -1553,6 +1588,7 @@ getValueOnEdge(Value *V, BasicBlock *FromBB, BasicBlock *ToBB,
                     << FromBB->getName() << "' to '" << ToBB->getName()
                     << "'\n");
 
+  flushCacheIfOverBudget();
   std::optional<ValueLatticeElement> Result =
       getEdgeValue(V, FromBB, ToBB, CxtI);
   while (!Result) {
@@ -142,6 +142,14 @@ STATISTIC(NumExitCountsNotComputed,
           "Number of loop exits without predictable exit counts");
 STATISTIC(NumBruteForceTripCountsComputed,
           "Number of loops with trip counts computed by force");
+STATISTIC(NumSCEVCacheHits, "Number of getSCEV queries answered from cache");
+STATISTIC(NumSCEVCacheMisses, "Number of getSCEV queries creating a SCEV");
+STATISTIC(NumRangeCacheHits, "Number of range queries answered from cache");
+STATISTIC(NumRangeCacheMisses, "Number of range queries computing a range");
+STATISTIC(NumBackedgeTakenInfoComputed,
+          "Number of loops with backedge-taken info computed");
+STATISTIC(NumSCEVsForgotten,
+          "Number of SCEVs whose memoized results were invalidated");
 
 #ifdef EXPENSIVE_CHECKS
 bool llvm::VerifySCEV = true;
@@ -4569,8 +4577,11 @@ void ScalarEvolution::insertValueToMap(Value *V, const SCEV *S) {
 const SCEV *ScalarEvolution::getSCEV(Value *V) {
   assert(isSCEVable(V->getType()) && "Value is not SCEVable!");
 
-  if (const SCEV *S = getExistingSCEV(V))
+  if (const SCEV *S = getExistingSCEV(V)) {
+    ++NumSCEVCacheHits;
     return S;
+  }
+  ++NumSCEVCacheMisses;
   return createSCEVIter(V);
 }
 
@@ -6623,8 +6634,11 @@ const ConstantRange &ScalarEvolution::getRangeRef(
 
   // See if we've computed this range already.
   DenseMap<const SCEV *, ConstantRange>::iterator I = Cache.find(S);
-  if (I != Cache.end())
+  if (I != Cache.end()) {
+    ++NumRangeCacheHits;
     return I->second;
+  }
+  ++NumRangeCacheMisses;
 
   if (const SCEVConstant *C = dyn_cast<SCEVConstant>(S))
     return setRange(C, SignHint, ConstantRange(C->getAPInt()));
@@ -8349,6 +8363,7 @@ ScalarEvolution::getBackedgeTakenInfo(const Loop *L) {
       BackedgeTakenCounts.insert({L, BackedgeTakenInfo()});
   if (!Pair.second)
     return Pair.first->second;
+  ++NumBackedgeTakenInfoComputed;
 
   // computeBackedgeTakenCount may allocate memory for its result. Inserting it
   // into the BackedgeTakenCounts map transfers ownership. Otherwise, the result
@@ -13999,6 +14014,7 @@ void ScalarEvolution::forgetMemoizedResults(ArrayRef<const SCEV *> SCEVs) {
           Worklist.push_back(User);
   }
 
+  NumSCEVsForgotten += ToForget.size();
   for (const auto *S : ToForget)
     forgetMemoizedResultsImpl(S);
 
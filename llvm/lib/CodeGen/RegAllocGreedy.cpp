@@ -127,6 +127,13 @@ static cl::opt<unsigned long> GrowRegionComplexityBudget(
              "limit its budget and bail out once we reach the limit."),
     cl::init(10000), cl::Hidden);
 
+static cl::opt<unsigned> EvictionBudget(
+    "regalloc-eviction-budget",
+    cl::desc("Maximum number of evictions per function before spillable "
+             "live ranges are only split or spilled (0 = unlimited). Bounds "
+             "compile time on very large functions."),
+    cl::init(0), cl::Hidden);
+
 static cl::opt<bool> GreedyRegClassPriorityTrumpsGlobalness(
     "greedy-regclass-priority-trumps-globalness",
     cl::desc("Change the greedy register allocator's live range priority "
@@ -586,8 +593,10 @@ MCRegister RAGreedy::tryEvict(const LiveInterval &VirtReg,
 
   MCRegister BestPhys = EvictAdvisor->tryFindEvictionCandidate(
       VirtReg, Order, CostPerUseLimit, FixedRegisters);
-  if (BestPhys.isValid())
+  if (BestPhys.isValid()) {
     evictInterference(VirtReg, BestPhys, NewVRegs);
+    ++NumEvictionsInFunction;
+  }
   return BestPhys;
 }
 
@@ -2442,8 +2451,13 @@ MCRegister RAGreedy::selectOrSplitImpl(const LiveInterval &VirtReg,
 
   // Try to evict a less worthy live range, but only for ranges from the primary
   // queue. The RS_Split ranges already failed to do this, and they should not
-  // get a second chance until they have been split.
-  if (Stage != RS_Split)
+  // get a second chance until they have been split. Once the eviction budget
+  // is exhausted, only unspillable ranges, which may have no other way to get
+  // a register, keep evicting.
+  bool WithinEvictionBudget = !EvictionBudget ||
+                              NumEvictionsInFunction < EvictionBudget ||
+                              !VirtReg.isSpillable();
+  if (Stage != RS_Split && WithinEvictionBudget)
     if (Register PhysReg =
             tryEvict(VirtReg, Order, NewVRegs, CostPerUseLimit,
                      FixedRegisters)) {
@@ -2749,6 +2763,7 @@ bool RAGreedy::runOnMachineFunction(MachineFunction &mf) {
                                : TRI->reverseLocalAssignment();
 
   ExtraInfo.emplace();
+  NumEvictionsInFunction = 0;
   EvictAdvisor =
       getAnalysis<RegAllocEvictionAdvisorAnalysis>().getAdvisor(*MF, *this);
   PriorityAdvisor =
@@ -204,6 +204,10 @@ private:
 
   uint8_t CutOffInfo = CutOffStage::CO_None;
 
+  /// Number of successful evictions in the current function, checked against
+  /// -regalloc-eviction-budget.
+  unsigned NumEvictionsInFunction = 0;
+
 #ifndef NDEBUG
   static const char *const StageName[];
 #endif
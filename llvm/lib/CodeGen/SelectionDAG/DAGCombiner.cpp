@@ -85,6 +85,7 @@ using namespace llvm::SDPatternMatch;
 #define DEBUG_TYPE "dagcombine"
 
 STATISTIC(NodesCombined   , "Number of dag nodes combined");
+STATISTIC(NodesVisited    , "Number of dag nodes visited by the combiner");
 STATISTIC(PreIndexedNodes , "Number of pre-indexed nodes created");
 STATISTIC(PostIndexedNodes, "Number of post-indexed nodes created");
 STATISTIC(OpsNarrowed     , "Number of load/op/store narrowed");
@@ -1776,6 +1777,7 @@ void DAGCombiner::Run(CombineLevel AtLevel) {
       AddToWorklist(ChildN.getNode(), /*IsCandidateForPruning=*/true,
                     /*SkipIfCombinedBefore=*/true);
 
+    ++NodesVisited;
     SDValue RV = combine(N);
 
     if (!RV.getNode())
@@ -1852,6 +1852,8 @@ void CompileUnit::verifyDependencies() {
   Dependencies.get()->verifyKeepChain();
 }
 
+void CompileUnit::cleanupDependencies() { Dependencies.reset(nullptr); }
+
 ArrayRef<dwarf::Attribute> dwarf_linker::parallel::getODRAttributes() {
   static dwarf::Attribute ODRAttributes[] = {
       dwarf::DW_AT_type, dwarf::DW_AT_specification,
@@ -131,6 +131,9 @@ public:
   /// Cleanup unneeded resources after compile unit is cloned.
   void cleanupDataAfterClonning();
 
+  /// Release the dependency tracker once the liveness information is final.
+  void cleanupDependencies();
+
   /// After cloning stage the output DIEs offsets are deallocated.
   /// This method copies output offsets for referenced DIEs into DIEs patches.
   void updateDieRefPatchesWithClonedOffsets();
@@ -655,6 +655,11 @@ void DWARFLinkerImpl::LinkContext::linkSingleCompileUnit(
 #ifndef NDEBUG
           CU.verifyDependencies();
 #endif
+          // The dependency work lists are not needed past this point. Free
+          // them now rather than after cloning: all compile units may be
+          // waiting for the type pool at this stage, and the lists of large
+          // units would otherwise all be alive at the same time.
+          CU.cleanupDependencies();
 
           if (ArtificialTypeUnit) {
             if (Error Err =
@@ -865,8 +870,10 @@ void DWARFLinkerImpl::glueCompileUnitsAndWriteToTheOutput() {
   // units into the resulting file.
   emitCommonSectionsAndWriteCompileUnitsToTheOutput();
 
-  if (ArtificialTypeUnit.get() != nullptr)
+  if (ArtificialTypeUnit.get() != nullptr) {
+    TypePoolMemorySize = ArtificialTypeUnit->getTypePool().getTotalMemory();
     ArtificialTypeUnit.reset();
+  }
 
   // Write common debug sections into the resulting file.
   writeCommonSectionsToTheOutput();
@@ -941,6 +948,9 @@ void DWARFLinkerImpl::printStatistic() {
                           ComputePercentange(InputTotal, OutputTotal));
   outs() << "----------------------------------------------------------------"
             "---------------\n\n";
+
+  if (TypePoolMemorySize)
+    outs() << "Type pool memory: " << TypePoolMemorySize << " bytes\n\n";
 }
 
 void DWARFLinkerImpl::assignOffsets() {
@@ -347,6 +347,9 @@ protected:
   std::unique_ptr<TypeUnit> ArtificialTypeUnit;
   /// @}
 
+  /// Memory held by the type pool when it was released, for statistics.
+  size_t TypePoolMemorySize = 0;
+
   /// \defgroup Data members accessed sequentially.
   ///
   /// @{
@@ -162,6 +162,9 @@ public:
     return Allocator.getThreadLocalAllocator();
   }
 
+  /// Return the memory, in bytes, held by the pool's allocators.
+  size_t getTotalMemory() const { return Allocator.getTotalMemory(); }
+
 protected:
   std::function<bool(const TypeEntry *LHS, const TypeEntry *RHS)>
       TypesComparator = [](const TypeEntry *LHS, const TypeEntry *RHS) -> bool {
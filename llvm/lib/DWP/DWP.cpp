@@ -20,6 +20,7 @@
 #include "llvm/Object/ELFObjectFile.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include <limits>
 
 using namespace llvm;
@@ -633,22 +634,35 @@ Error write(MCStreamer &Out, ArrayRef<std::string> Inputs,
 
   DWPStringPool Strings(Out, StrSection);
 
-  SmallVector<OwningBinary<object::ObjectFile>, 128> Objects;
-  Objects.reserve(Inputs.size());
+  // Open all of the inputs up front. Mapping and parsing the object files is
+  // independent for each input and, with thousands of .dwo files, dominated
+  // by file system latency, so do it in parallel. The sections are still
+  // emitted in input order below.
+  std::vector<OwningBinary<object::ObjectFile>> Objects(Inputs.size());
+  // Report the error for the first input that failed to open, as opening them
+  // one by one would.
+  size_t ErrorIdx;
+  if (Error OpenErr = parallelForFirstError(
+          0, Inputs.size(),
+          [&](size_t I) -> Error {
+            auto ErrOrObj = object::ObjectFile::createObjectFile(Inputs[I]);
+            if (!ErrOrObj)
+              return ErrOrObj.takeError();
+            Objects[I] = std::move(*ErrOrObj);
+            return Error::success();
+          },
+          &ErrorIdx))
+    return handleErrors(std::move(OpenErr),
+                        [&](std::unique_ptr<ECError> EC) -> Error {
+                          return createFileError(Inputs[ErrorIdx],
+                                                 Error(std::move(EC)));
+                        });
 
   std::deque<SmallString<32>> UncompressedSections;
 
-  for (const auto &Input : Inputs) {
-    auto ErrOrObj = object::ObjectFile::createObjectFile(Input);
-    if (!ErrOrObj) {
-      return handleErrors(ErrOrObj.takeError(),
-                          [&](std::unique_ptr<ECError> EC) -> Error {
-                            return createFileError(Input, Error(std::move(EC)));
-                          });
-    }
-
-    auto &Obj = *ErrOrObj->getBinary();
-    Objects.push_back(std::move(*ErrOrObj));
+  for (size_t I = 0, N = Inputs.size(); I < N; ++I) {
+    const std::string &Input = Inputs[I];
+    auto &Obj = *Objects[I].getBinary();
 
     UnitIndexEntry CurEntry = {};
 
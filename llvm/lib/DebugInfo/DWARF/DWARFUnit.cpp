@@ -496,6 +496,9 @@ void DWARFUnit::extractDIEsIfNeeded(bool CUDieOnly) {
 }
 
 Error DWARFUnit::tryExtractDIEsIfNeeded(bool CUDieOnly) {
+  std::unique_lock<std::recursive_mutex> Lock(DieArrayMutex, std::defer_lock);
+  if (Context.isThreadSafe())
+    Lock.lock();
   if ((CUDieOnly && !DieArray.empty()) ||
       DieArray.size() > 1)
     return Error::success(); // Already parsed.
@@ -653,6 +656,9 @@ bool DWARFUnit::parseDWO(StringRef DWOAlternativeLocation) {
 }
 
 void DWARFUnit::clearDIEs(bool KeepCUDie) {
+  std::unique_lock<std::recursive_mutex> Lock(DieArrayMutex, std::defer_lock);
+  if (Context.isThreadSafe())
+    Lock.lock();
   // Do not use resize() + shrink_to_fit() to free memory occupied by dies.
   // shrink_to_fit() is a *non-binding* request to reduce capacity() to size().
   // It depends on the implementation whether the request is fulfilled.
@@ -11,6 +11,7 @@
 #include "llvm/DebugInfo/GSYM/LineTable.h"
 #include "llvm/DebugInfo/GSYM/OutputAggregator.h"
 #include "llvm/MC/StringTableBuilder.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include <algorithm>
@@ -168,13 +169,39 @@ llvm::Error GsymCreator::encode(FileWriter &O) const {
   StrTab.write(O.get_stream());
   const off_t StrtabSize = O.tell() - StrtabOffset;
   std::vector<uint32_t> AddrInfoOffsets;
-
-  // Write out the address infos for each function info.
-  for (const auto &FuncInfo : Funcs) {
-    if (Expected<uint64_t> OffsetOrErr = FuncInfo.encode(O))
-      AddrInfoOffsets.push_back(OffsetOrErr.get());
-    else
-      return OffsetOrErr.takeError();
+  AddrInfoOffsets.reserve(Funcs.size());
+
+  // Write out the address infos for each function info. Encoding line tables
+  // and inline info dominates the time spent here for large binaries, so
+  // encode a batch of function infos in parallel into separate buffers and
+  // then append them in order. FunctionInfo::encode() starts with aligning to
+  // 4 bytes and only uses offsets relative to its own start, so the bytes are
+  // identical to encoding straight into O. Batching bounds the extra memory
+  // to the encodings of a single batch.
+  constexpr size_t BatchSize = 4096;
+  std::vector<SmallString<64>> Encodings;
+  for (size_t Start = 0, N = Funcs.size(); Start < N; Start += BatchSize) {
+    const size_t Count = std::min(BatchSize, N - Start);
+    Encodings.assign(Count, SmallString<64>());
+    // Report the error of the first function info that failed to encode, as
+    // encoding serially would.
+    Error Err = parallelForFirstError(0, Count, [&](size_t I) -> Error {
+      raw_svector_ostream OutStrm(Encodings[I]);
+      FileWriter FW(OutStrm, O.getByteOrder());
+      Expected<uint64_t> OffsetOrErr = Funcs[Start + I].encode(FW);
+      if (!OffsetOrErr)
+        return OffsetOrErr.takeError();
+      assert(*OffsetOrErr == 0);
+      return Error::success();
+    });
+    if (Err)
+      return Err;
+    for (const SmallString<64> &Encoding : Encodings) {
+      O.alignTo(4);
+      AddrInfoOffsets.push_back(O.tell());
+      O.writeData(ArrayRef<uint8_t>((const uint8_t *)Encoding.data(),
+                                    Encoding.size()));
+    }
   }
   // Fixup the string table offset and size in the header
   O.fixup32((uint32_t)StrtabOffset, offsetof(Header, StrtabOffset));
@@ -23,6 +23,7 @@
 
 #include "llvm/Debuginfod/Debuginfod.h"
 #include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/BinaryFormat/Magic.h"
 #include "llvm/DebugInfo/DWARF/DWARFContext.h"
@@ -41,6 +42,8 @@
 #include "llvm/Support/xxhash.h"
 
 #include <atomic>
+#include <condition_variable>
+#include <memory>
 #include <optional>
 #include <thread>
 
@@ -52,6 +55,85 @@ namespace {
 std::optional<SmallVector<StringRef>> DebuginfodUrls;
 // Many Readers/Single Writer lock protecting the global debuginfod URL list.
 llvm::sys::RWMutex UrlsMutex;
+
+// The cache paths of the artifacts currently being downloaded by this process.
+// Threads asking for an artifact that is already being downloaded wait for
+// that download instead of fetching the same artifact again, and share its
+// failure if it fails.
+struct InFlightState {
+  bool Done = false;
+  bool Failed = false;
+  std::error_code EC;
+  std::string Message;
+};
+std::mutex InFlightMutex;
+std::condition_variable InFlightCV;
+StringMap<std::shared_ptr<InFlightState>> InFlightArtifacts;
+
+/// Marks an artifact as being downloaded for as long as it is alive.
+class InFlightDownload {
+  std::string Path;
+  std::shared_ptr<InFlightState> State;
+
+public:
+  /// Wait for any other download of \p ArtifactPath in this process. Returns
+  /// the error of that download if it failed, or std::nullopt if it succeeded,
+  /// in which case the cache has to be checked again. If no download was in
+  /// progress, returns the download the caller has to perform.
+  static Expected<std::optional<InFlightDownload>>
+  acquire(StringRef ArtifactPath) {
+    std::unique_lock<std::mutex> Guard(InFlightMutex);
+    auto [It, Inserted] = InFlightArtifacts.try_emplace(ArtifactPath);
+    if (Inserted) {
+      It->second = std::make_shared<InFlightState>();
+      return std::optional<InFlightDownload>(
+          InFlightDownload(ArtifactPath, It->second));
+    }
+    std::shared_ptr<InFlightState> Other = It->second;
+    InFlightCV.wait(Guard, [&] { return Other->Done; });
+    if (Other->Failed)
+      return createStringError(Other->EC, Other->Message);
+    return std::nullopt;
+  }
+
+  /// Record \p Err as the result of this download for the threads waiting on
+  /// it, and return it.
+  Error fail(Error Err) {
+    std::string Message;
+    std::error_code EC;
+    handleAllErrors(std::move(Err), [&](const ErrorInfoBase &EI) {
+      if (!Message.empty())
+        Message += '\n';
+      Message += EI.message();
+      EC = EI.convertToErrorCode();
+    });
+    {
+      std::lock_guard<std::mutex> Guard(InFlightMutex);
+      State->Failed = true;
+      State->EC = EC;
+      State->Message = Message;
+    }
+    return createStringError(EC, Message);
+  }
+
+  InFlightDownload(InFlightDownload &&Other)
+      : Path(std::move(Other.Path)), State(std::move(Other.State)) {}
+  InFlightDownload(const InFlightDownload &) = delete;
+  ~InFlightDownload() {
+    if (!State)
+      return;
+    {
+      std::lock_guard<std::mutex> Guard(InFlightMutex);
+      State->Done = true;
+      InFlightArtifacts.erase(Path);
+    }
+    InFlightCV.notify_all();
+  }
+
+private:
+  InFlightDownload(StringRef Path, std::shared_ptr<InFlightState> State)
+      : Path(Path.str()), State(std::move(State)) {}
+};
 } // namespace
 
 std::string getDebuginfodCacheKey(llvm::StringRef S) {
@@ -248,29 +330,17 @@ static SmallVector<std::string, 0> getHeaders() {
   return Headers;
 }
 
-Expected<std::string> getCachedOrDownloadArtifact(
-    StringRef UniqueKey, StringRef UrlPath, StringRef CacheDirectoryPath,
-    ArrayRef<StringRef> DebuginfodUrls, std::chrono::milliseconds Timeout) {
-  SmallString<64> AbsCachedArtifactPath;
-  sys::path::append(AbsCachedArtifactPath, CacheDirectoryPath,
-                    "llvmcache-" + UniqueKey);
-
-  Expected<FileCache> CacheOrErr =
-      localCache("Debuginfod-client", ".debuginfod-client", CacheDirectoryPath);
-  if (!CacheOrErr)
-    return CacheOrErr.takeError();
-
-  FileCache Cache = *CacheOrErr;
+// Query the debuginfod servers for an artifact that is not in the local cache
+// and write it to the cache.
+static Expected<std::string>
+downloadArtifact(StringRef UrlPath, StringRef CacheDirectoryPath,
+                 StringRef AbsCachedArtifactPath,
+                 ArrayRef<StringRef> DebuginfodUrls,
+                 std::chrono::milliseconds Timeout,
+                 AddStreamFn &CacheAddStream) {
   // We choose an arbitrary Task parameter as we do not make use of it.
   unsigned Task = 0;
-  Expected<AddStreamFn> CacheAddStreamOrErr = Cache(Task, UniqueKey, "");
-  if (!CacheAddStreamOrErr)
-    return CacheAddStreamOrErr.takeError();
-  AddStreamFn &CacheAddStream = *CacheAddStreamOrErr;
-  if (!CacheAddStream)
-    return std::string(AbsCachedArtifactPath);
-  // The artifact was not found in the local cache, query the debuginfod
-  // servers.
+
   if (!HTTPClient::isAvailable())
     return createStringError(errc::io_error,
                              "No working HTTP client is available.");
@@ -317,6 +387,44 @@ Expected<std::string> getCachedOrDownloadArtifact(
   return createStringError(errc::argument_out_of_domain, "build id not found");
 }
 
+Expected<std::string> getCachedOrDownloadArtifact(
+    StringRef UniqueKey, StringRef UrlPath, StringRef CacheDirectoryPath,
+    ArrayRef<StringRef> DebuginfodUrls, std::chrono::milliseconds Timeout) {
+  SmallString<64> AbsCachedArtifactPath;
+  sys::path::append(AbsCachedArtifactPath, CacheDirectoryPath,
+                    "llvmcache-" + UniqueKey);
+
+  Expected<FileCache> CacheOrErr =
+      localCache("Debuginfod-client", ".debuginfod-client", CacheDirectoryPath);
+  if (!CacheOrErr)
+    return CacheOrErr.takeError();
+
+  FileCache Cache = *CacheOrErr;
+  // We choose an arbitrary Task parameter as we do not make use of it.
+  unsigned Task = 0;
+  Expected<AddStreamFn> CacheAddStreamOrErr = Cache(Task, UniqueKey, "");
+  if (!CacheAddStreamOrErr)
+    return CacheAddStreamOrErr.takeError();
+  AddStreamFn &CacheAddStream = *CacheAddStreamOrErr;
+  if (!CacheAddStream)
+    return std::string(AbsCachedArtifactPath);
+  // If another thread is already downloading this artifact, wait for it and
+  // look in the cache again, or return its error if it failed.
+  Expected<std::optional<InFlightDownload>> DownloadOrErr =
+      InFlightDownload::acquire(AbsCachedArtifactPath);
+  if (!DownloadOrErr)
+    return DownloadOrErr.takeError();
+  if (!*DownloadOrErr)
+    return getCachedOrDownloadArtifact(UniqueKey, UrlPath, CacheDirectoryPath,
+                                       DebuginfodUrls, Timeout);
+  Expected<std::string> PathOrErr =
+      downloadArtifact(UrlPath, CacheDirectoryPath, AbsCachedArtifactPath,
+                       DebuginfodUrls, Timeout, CacheAddStream);
+  if (!PathOrErr)
+    return (*DownloadOrErr)->fail(PathOrErr.takeError());
+  return PathOrErr;
+}
+
 DebuginfodLogEntry::DebuginfodLogEntry(const Twine &Message)
     : Message(Message.str()) {}
 
@@ -1145,7 +1145,19 @@ Pattern::MatchResult Pattern::match(StringRef Buffer,
   unsigned int Flags = Regex::Newline;
   if (IgnoreCase)
     Flags |= Regex::IgnoreCase;
-  if (!Regex(RegExToMatch, Flags).match(Buffer, &MatchInfo))
+  // Implicit CHECK-NOTs are matched between every pair of checks and
+  // CHECK-DAGs may be matched many times, so compile a regex that does not
+  // depend on substitutions only once.
+  std::optional<Regex> SubstitutedRegEx;
+  const Regex *RE;
+  if (Substitutions.empty()) {
+    if (!CompiledRegEx)
+      CompiledRegEx = std::make_shared<Regex>(RegExStr, Flags);
+    RE = CompiledRegEx.get();
+  } else {
+    RE = &SubstitutedRegEx.emplace(RegExToMatch, Flags);
+  }
+  if (!RE->match(Buffer, &MatchInfo))
     return make_error<NotFoundError>();
 
   // Successful regex match.
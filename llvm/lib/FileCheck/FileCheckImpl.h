@@ -20,8 +20,10 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/FileCheck/FileCheck.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/Regex.h"
 #include "llvm/Support/SourceMgr.h"
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -573,6 +575,11 @@ class Pattern {
   /// a fixed string to match.
   std::string RegExStr;
 
+  /// RegExStr compiled on first use, if the pattern has no substitutions and
+  /// hence always matches with the same regex. Shared between the copies of
+  /// this pattern.
+  mutable std::shared_ptr<Regex> CompiledRegEx;
+
   /// Entries in this vector represent a substitution of a string variable or
   /// an expression in the RegExStr regex at match time. For example, in the
   /// case of a CHECK directive with the pattern "foo[[bar]]baz[[#N+1]]",
@@ -31,6 +31,7 @@
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Memory.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
@@ -39,6 +40,7 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -220,6 +222,7 @@ Error Object::compressOrDecompressSections(const CommonConfig &Config) {
   // because it would mutate the sections array.
   SmallVector<std::pair<SectionBase *, std::function<SectionBase *()>>, 0>
       ToReplace;
+  SmallVector<std::pair<SectionBase *, DebugCompressionType>, 0> ToCompress;
   for (SectionBase &Sec : sections()) {
     std::optional<DebugCompressionType> CType;
     for (auto &[Matcher, T] : Config.compressSections)
@@ -247,16 +250,26 @@ Error Object::compressOrDecompressSections(const CommonConfig &Config) {
         ToReplace.emplace_back(
             &Sec, [=] { return &addSection<DecompressedSection>(*CS); });
     } else if (*CType != DebugCompressionType::None) {
-      ToReplace.emplace_back(&Sec, [=, S = &Sec] {
-        return &addSection<CompressedSection>(
-            CompressedSection(*S, *CType, Is64Bits));
-      });
+      ToCompress.emplace_back(&Sec, *CType);
     }
   }
 
+  // Compressing the sections is independent for each section and dominates
+  // the run time for large binaries, so do it in parallel. Adding the new
+  // sections has to happen serially afterwards; their final position is
+  // determined by the index of the section they replace.
+  std::vector<std::optional<CompressedSection>> Compressed(ToCompress.size());
+  parallelFor(0, ToCompress.size(), [&](size_t I) {
+    auto [S, CType] = ToCompress[I];
+    Compressed[I].emplace(*S, CType, Is64Bits);
+  });
+
   DenseMap<SectionBase *, SectionBase *> FromTo;
   for (auto [S, Func] : ToReplace)
     FromTo[S] = Func();
+  for (size_t I = 0, E = ToCompress.size(); I != E; ++I)
+    FromTo[ToCompress[I].first] =
+        &addSection<CompressedSection>(std::move(*Compressed[I]));
   return replaceSections(FromTo);
 }
 
@@ -31,6 +31,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/Format.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SmallVectorMemoryBuffer.h"
 #include "llvm/Support/raw_ostream.h"
@@ -818,13 +819,42 @@ computeMemberData(raw_ostream &StringTable, raw_ostream &SymNames,
   std::vector<std::unique_ptr<SymbolicFile>> SymFiles;
 
   if (NeedSymbols != SymtabWritingMode::NoSymtab || isAIXBigArchive(Kind)) {
-    for (const NewArchiveMember &M : NewMembers) {
+    // Parsing the members is independent for each member, except that bitcode
+    // members share Context, which is not thread safe. Parse all other members
+    // in parallel and the bitcode members serially afterwards. As when parsing
+    // them in order, the error of the first member that fails is reported.
+    SymFiles.resize(NewMembers.size());
+    auto ParseMember = [&](size_t I) -> Error {
       Expected<std::unique_ptr<SymbolicFile>> SymFileOrErr =
-          getSymbolicFile(M.Buf->getMemBufferRef(), Context);
+          getSymbolicFile(NewMembers[I].Buf->getMemBufferRef(), Context);
       if (!SymFileOrErr)
-        return createFileError(M.MemberName, SymFileOrErr.takeError());
-      SymFiles.push_back(std::move(*SymFileOrErr));
+        return SymFileOrErr.takeError();
+      SymFiles[I] = std::move(*SymFileOrErr);
+      return Error::success();
+    };
+    auto IsBitcode = [&](size_t I) {
+      return identify_magic(NewMembers[I].Buf->getBuffer()) ==
+             file_magic::bitcode;
+    };
+    size_t ErrorIdx;
+    Error Err = parallelForFirstError(
+        0, NewMembers.size(),
+        [&](size_t I) -> Error {
+          return IsBitcode(I) ? Error::success() : ParseMember(I);
+        },
+        &ErrorIdx);
+    // Only bitcode members before the first failing one can fail earlier.
+    for (size_t I = 0; I < ErrorIdx; ++I) {
+      if (!IsBitcode(I))
+        continue;
+      if (Error BitcodeErr = ParseMember(I)) {
+        consumeError(std::move(Err));
+        Err = std::move(BitcodeErr);
+        ErrorIdx = I;
+      }
     }
+    if (Err)
+      return createFileError(NewMembers[ErrorIdx].MemberName, std::move(Err));
   }
 
   if (SymMap) {
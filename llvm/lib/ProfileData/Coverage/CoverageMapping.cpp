@@ -27,6 +27,8 @@
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Support/VirtualFileSystem.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
@@ -967,48 +969,73 @@ static Error handleMaybeNoDataFoundError(Error E) {
       });
 }
 
-Error CoverageMapping::loadFromFile(
-    StringRef Filename, StringRef Arch, StringRef CompilationDir,
-    IndexedInstrProfReader &ProfileReader, CoverageMapping &Coverage,
-    bool &DataFound, SmallVectorImpl<object::BuildID> *FoundBinaryIDs) {
+struct CoverageMapping::ObjectReaders {
+  std::unique_ptr<MemoryBuffer> ObjectBuffer;
+  SmallVector<std::unique_ptr<MemoryBuffer>, 4> Buffers;
+  SmallVector<std::unique_ptr<CoverageMappingReader>, 4> Readers;
+  SmallVector<object::BuildIDRef> BinaryIDs;
+};
+
+Expected<CoverageMapping::ObjectReaders>
+CoverageMapping::readObject(StringRef Filename, StringRef Arch,
+                            StringRef CompilationDir, bool CollectBinaryIDs) {
   auto CovMappingBufOrErr = MemoryBuffer::getFileOrSTDIN(
       Filename, /*IsText=*/false, /*RequiresNullTerminator=*/false);
   if (std::error_code EC = CovMappingBufOrErr.getError())
     return createFileError(Filename, errorCodeToError(EC));
-  MemoryBufferRef CovMappingBufRef =
-      CovMappingBufOrErr.get()->getMemBufferRef();
-  SmallVector<std::unique_ptr<MemoryBuffer>, 4> Buffers;
+  ObjectReaders Object;
+  Object.ObjectBuffer = std::move(CovMappingBufOrErr.get());
+  MemoryBufferRef CovMappingBufRef = Object.ObjectBuffer->getMemBufferRef();
 
-  SmallVector<object::BuildIDRef> BinaryIDs;
   auto CoverageReadersOrErr = BinaryCoverageReader::create(
-      CovMappingBufRef, Arch, Buffers, CompilationDir,
-      FoundBinaryIDs ? &BinaryIDs : nullptr);
+      CovMappingBufRef, Arch, Object.Buffers, CompilationDir,
+      CollectBinaryIDs ? &Object.BinaryIDs : nullptr);
   if (Error E = CoverageReadersOrErr.takeError()) {
     E = handleMaybeNoDataFoundError(std::move(E));
     if (E)
       return createFileError(Filename, std::move(E));
-    return E;
+    return ObjectReaders();
   }
 
-  SmallVector<std::unique_ptr<CoverageMappingReader>, 4> Readers;
   for (auto &Reader : CoverageReadersOrErr.get())
-    Readers.push_back(std::move(Reader));
-  if (FoundBinaryIDs && !Readers.empty()) {
+    Object.Readers.push_back(std::move(Reader));
+  return std::move(Object);
+}
+
+Error CoverageMapping::loadFromObject(
+    StringRef Filename, ObjectReaders &Object,
+    IndexedInstrProfReader &ProfileReader, CoverageMapping &Coverage,
+    bool &DataFound, SmallVectorImpl<object::BuildID> *FoundBinaryIDs) {
+  if (FoundBinaryIDs && !Object.Readers.empty()) {
     llvm::append_range(*FoundBinaryIDs,
-                       llvm::map_range(BinaryIDs, [](object::BuildIDRef BID) {
-                         return object::BuildID(BID);
-                       }));
+                       llvm::map_range(Object.BinaryIDs,
+                                       [](object::BuildIDRef BID) {
+                                         return object::BuildID(BID);
+                                       }));
   }
-  DataFound |= !Readers.empty();
-  if (Error E = loadFromReaders(Readers, ProfileReader, Coverage))
+  DataFound |= !Object.Readers.empty();
+  if (Error E = loadFromReaders(Object.Readers, ProfileReader, Coverage))
     return createFileError(Filename, std::move(E));
   return Error::success();
 }
 
+Error CoverageMapping::loadFromFile(
+    StringRef Filename, StringRef Arch, StringRef CompilationDir,
+    IndexedInstrProfReader &ProfileReader, CoverageMapping &Coverage,
+    bool &DataFound, SmallVectorImpl<object::BuildID> *FoundBinaryIDs) {
+  auto ObjectOrErr =
+      readObject(Filename, Arch, CompilationDir, FoundBinaryIDs != nullptr);
+  if (Error E = ObjectOrErr.takeError())
+    return E;
+  return loadFromObject(Filename, *ObjectOrErr, ProfileReader, Coverage,
+                        DataFound, FoundBinaryIDs);
+}
+
 Expected<std::unique_ptr<CoverageMapping>> CoverageMapping::load(
     ArrayRef<StringRef> ObjectFilenames, StringRef ProfileFilename,
     vfs::FileSystem &FS, ArrayRef<StringRef> Arches, StringRef CompilationDir,
-    const object::BuildIDFetcher *BIDFetcher, bool CheckBinaryIDs) {
+    const object::BuildIDFetcher *BIDFetcher, bool CheckBinaryIDs,
+    unsigned NumThreads) {
   auto ProfileReaderOrErr = IndexedInstrProfReader::create(ProfileFilename, FS);
   if (Error E = ProfileReaderOrErr.takeError())
     return createFileError(ProfileFilename, std::move(E));
@@ -1025,11 +1052,54 @@ Expected<std::unique_ptr<CoverageMapping>> CoverageMapping::load(
   };
 
   SmallVector<object::BuildID> FoundBinaryIDs;
-  for (const auto &File : llvm::enumerate(ObjectFilenames)) {
-    if (Error E =
-            loadFromFile(File.value(), GetArch(File.index()), CompilationDir,
-                         *ProfileReader, *Coverage, DataFound, &FoundBinaryIDs))
-      return std::move(E);
+  if (NumThreads == 1 || ObjectFilenames.size() <= 1) {
+    for (const auto &File : llvm::enumerate(ObjectFilenames)) {
+      if (Error E = loadFromFile(File.value(), GetArch(File.index()),
+                                 CompilationDir, *ProfileReader, *Coverage,
+                                 DataFound, &FoundBinaryIDs))
+        return std::move(E);
+    }
+  } else {
+    // Reading and decoding the coverage mapping of an object is independent
+    // of everything else, but the records have to be added one object at a
+    // time, in order, for the result to be deterministic. Read a bounded
+    // number of objects ahead of the one whose records are being loaded.
+    size_t NumFiles = ObjectFilenames.size();
+    std::vector<std::optional<Expected<ObjectReaders>>> Objects(NumFiles);
+    std::vector<std::shared_future<void>> Pending(NumFiles);
+    DefaultThreadPool Pool(hardware_concurrency(NumThreads));
+    size_t ReadAhead = 2 * Pool.getMaxConcurrency();
+    auto StartReading = [&](size_t I) {
+      Pending[I] = Pool.async([&, I] {
+        Objects[I].emplace(readObject(ObjectFilenames[I], GetArch(I),
+                                      CompilationDir,
+                                      /*CollectBinaryIDs=*/true));
+      });
+    };
+    for (size_t I = 0, E = std::min(ReadAhead, NumFiles); I != E; ++I)
+      StartReading(I);
+
+    // On error, wait for the objects that were read ahead and drop them.
+    auto Abandon = [&](size_t Next, Error E) {
+      Pool.wait();
+      for (size_t I = Next; I != NumFiles; ++I)
+        if (Objects[I])
+          consumeError(Objects[I]->takeError());
+      return E;
+    };
+    for (size_t I = 0; I != NumFiles; ++I) {
+      if (I + ReadAhead < NumFiles)
+        StartReading(I + ReadAhead);
+      Pending[I].wait();
+      Expected<ObjectReaders> &ObjectOrErr = *Objects[I];
+      if (Error E = ObjectOrErr.takeError())
+        return Abandon(I + 1, std::move(E));
+      if (Error E = loadFromObject(ObjectFilenames[I], *ObjectOrErr,
+                                   *ProfileReader, *Coverage, DataFound,
+                                   &FoundBinaryIDs))
+        return Abandon(I + 1, std::move(E));
+      Objects[I].reset();
+    }
   }
 
   if (BIDFetcher) {
@@ -1418,28 +1418,24 @@ Error IndexedInstrProfReader::readHeader() {
     // Expect at least two 64 bit fields: NumTraces, and TraceStreamSize
     if (Ptr + 2 * sizeof(uint64_t) > PtrEnd)
       return error(instrprof_error::truncated);
-    const uint64_t NumTraces =
+    NumTemporalProfTraces =
         support::endian::readNext<uint64_t, llvm::endianness::little>(Ptr);
     TemporalProfTraceStreamSize =
         support::endian::readNext<uint64_t, llvm::endianness::little>(Ptr);
-    for (unsigned i = 0; i < NumTraces; i++) {
+    TemporalProfTracesStart = Ptr;
+    // Check the bounds of every trace now, so that a truncated file is still
+    // rejected when it is opened. The traces are decoded on first use.
+    for (unsigned i = 0; i < NumTemporalProfTraces; i++) {
       // Expect at least two 64 bit fields: Weight and NumFunctions
       if (Ptr + 2 * sizeof(uint64_t) > PtrEnd)
         return error(instrprof_error::truncated);
-      TemporalProfTraceTy Trace;
-      Trace.Weight =
-          support::endian::readNext<uint64_t, llvm::endianness::little>(Ptr);
+      Ptr += sizeof(uint64_t);
       const uint64_t NumFunctions =
           support::endian::readNext<uint64_t, llvm::endianness::little>(Ptr);
       // Expect at least NumFunctions 64 bit fields
-      if (Ptr + NumFunctions * sizeof(uint64_t) > PtrEnd)
+      if (NumFunctions > uint64_t(PtrEnd - Ptr) / sizeof(uint64_t))
         return error(instrprof_error::truncated);
-      for (unsigned j = 0; j < NumFunctions; j++) {
-        const uint64_t NameRef =
-            support::endian::readNext<uint64_t, llvm::endianness::little>(Ptr);
-        Trace.FunctionNameRefs.push_back(NameRef);
-      }
-      TemporalProfTraces.push_back(std::move(Trace));
+      Ptr += NumFunctions * sizeof(uint64_t);
     }
   }
 
@@ -1458,6 +1454,35 @@ Error IndexedInstrProfReader::readHeader() {
   return success();
 }
 
+void IndexedInstrProfReader::readTemporalProfTraces() {
+  // readHeader() has already checked that every trace is in bounds.
+  const unsigned char *Ptr = TemporalProfTracesStart;
+  for (unsigned i = 0; i < NumTemporalProfTraces; i++) {
+    TemporalProfTraceTy Trace;
+    Trace.Weight =
+        support::endian::readNext<uint64_t, llvm::endianness::little>(Ptr);
+    const uint64_t NumFunctions =
+        support::endian::readNext<uint64_t, llvm::endianness::little>(Ptr);
+    for (unsigned j = 0; j < NumFunctions; j++) {
+      const uint64_t NameRef =
+          support::endian::readNext<uint64_t, llvm::endianness::little>(Ptr);
+      Trace.FunctionNameRefs.push_back(NameRef);
+    }
+    TemporalProfTraces.push_back(std::move(Trace));
+  }
+}
+
+SmallVector<TemporalProfTraceTy> &
+IndexedInstrProfReader::getTemporalProfTraces(std::optional<uint64_t> Weight) {
+  // Like other non-raw readers, ignore the input weight and use the weights
+  // already in the traces.
+  if (TemporalProfTracesStart) {
+    readTemporalProfTraces();
+    TemporalProfTracesStart = nullptr;
+  }
+  return TemporalProfTraces;
+}
+
 InstrProfSymtab &IndexedInstrProfReader::getSymtab() {
   if (Symtab)
     return *Symtab;
@@ -18,6 +18,7 @@
 #include "llvm/ProfileData/PGOCtxProfWriter.h"
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/Error.h"
+#include "llvm/Support/MathExtras.h"
 
 using namespace llvm;
 
@@ -51,6 +52,51 @@ void PGOContextualProfile::getContainedGuids(
       Callee.getContainedGuids(Guids);
 }
 
+Error PGOContextualProfile::checkMergeable(
+    const PGOContextualProfile &Other) const {
+  if (GUID != Other.GUID)
+    return make_error<InstrProfError>(instrprof_error::invalid_prof,
+                                      "Merging contexts of different GUIDs.");
+  if (Counters.size() != Other.Counters.size())
+    return make_error<InstrProfError>(instrprof_error::count_mismatch,
+                                      "Mismatched counter counts.");
+  for (const auto &[Index, OtherTargets] : Other.Callsites) {
+    auto TargetsIt = Callsites.find(Index);
+    if (TargetsIt == Callsites.end())
+      continue;
+    for (const auto &[G, Callee] : OtherTargets) {
+      auto It = TargetsIt->second.find(G);
+      if (It != TargetsIt->second.end())
+        RET_ON_ERR(It->second.checkMergeable(Callee));
+    }
+  }
+  return Error::success();
+}
+
+void PGOContextualProfile::mergeChecked(PGOContextualProfile &&Other) {
+  for (auto [Mine, Theirs] : zip(Counters, Other.Counters))
+    Mine = SaturatingAdd(Mine, Theirs);
+
+  for (auto &[Index, OtherTargets] : Other.Callsites) {
+    auto &Targets = Callsites[Index];
+    for (auto &[G, Callee] : OtherTargets) {
+      auto It = Targets.find(G);
+      if (It == Targets.end())
+        Targets.insert({G, std::move(Callee)});
+      else
+        It->second.mergeChecked(std::move(Callee));
+    }
+  }
+}
+
+Error PGOContextualProfile::merge(PGOContextualProfile &&Other) {
+  // Validate the whole tree first, so a mismatch deep in the callees doesn't
+  // leave this context partially merged.
+  RET_ON_ERR(checkMergeable(Other));
+  mergeChecked(std::move(Other));
+  return Error::success();
+}
+
 Expected<BitstreamEntry> PGOCtxProfileReader::advance() {
   return Cursor.advance(BitstreamCursor::AF_DontAutoprocessAbbrevs);
 }
@@ -11,14 +11,20 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/FileOutputBuffer.h"
+#include "llvm/ADT/ScopeExit.h"
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Memory.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Support/TimeProfiler.h"
 #include <system_error>
 
 #if !defined(_MSC_VER) && !defined(__MINGW32__)
 #include <unistd.h>
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
 #else
 #include <io.h>
 #endif
@@ -102,7 +108,20 @@ public:
             openFileForWrite(FinalPath, FD, CD_CreateAlways, OF_None, Mode))
       return errorCodeToError(EC);
     raw_fd_ostream OS(FD, /*shouldClose=*/true, /*unbuffered=*/true);
-    OS << StringRef((const char *)Buffer.base(), BufferSize);
+
+    // Write the buffer in chunks and give the pages of each written chunk
+    // back to the OS right away. Otherwise the whole output would be resident
+    // twice, once in this buffer and once in the page cache, until commit()
+    // returns.
+    const size_t ChunkSize = 64 * 1024 * 1024;
+    for (size_t I = 0; I < BufferSize; I += ChunkSize) {
+      size_t Len = std::min(ChunkSize, BufferSize - I);
+      OS << StringRef((const char *)Buffer.base() + I, Len);
+#if defined(__linux__)
+      if (Len == ChunkSize)
+        ::madvise((char *)Buffer.base() + I, Len, MADV_DONTNEED);
+#endif
+    }
     return Error::success();
   }
 
@@ -112,6 +131,124 @@ private:
   size_t BufferSize;
   unsigned Mode;
 };
+
+// A write lease can only be taken while no other open file description or
+// mapping of the file exists, including those of shared libraries whose file
+// descriptor was closed after mapping them. Other systems offer no way to tell
+// whether a file is in use, so files are never updated in place there.
+static bool acquireWriteLease(int FD) {
+#if defined(__linux__)
+  return ::fcntl(FD, F_SETLEASE, F_WRLCK) == 0;
+#else
+  (void)FD;
+  return false;
+#endif
+}
+
+static void releaseWriteLease(int FD) {
+#if defined(__linux__)
+  ::fcntl(FD, F_SETLEASE, F_UNLCK);
+#else
+  (void)FD;
+#endif
+}
+
+// A FileOutputBuffer which keeps data in memory and, on commit(), copies only
+// the pages that differ from an existing output file of the same size into
+// that file. This is used for F_update_in_place.
+//
+// Writing into the existing file is visible to every process that has it open
+// or mapped, such as a running executable or a loaded shared library, and
+// through all of its hard links. If any of that cannot be ruled out, or the
+// file cannot be opened or mapped, the file is atomically replaced instead.
+class InPlaceUpdateBuffer : public FileOutputBuffer {
+public:
+  InPlaceUpdateBuffer(StringRef Path, MemoryBlock Buf, std::size_t BufSize,
+                      unsigned Mode)
+      : FileOutputBuffer(Path), Buffer(Buf), BufferSize(BufSize), Mode(Mode) {}
+
+  uint8_t *getBufferStart() const override { return (uint8_t *)Buffer.base(); }
+
+  uint8_t *getBufferEnd() const override {
+    return (uint8_t *)Buffer.base() + BufferSize;
+  }
+
+  size_t getBufferSize() const override { return BufferSize; }
+
+  Error commit() override {
+    llvm::TimeTraceScope timeScope("Update buffer in place");
+    if (updateInPlace())
+      return Error::success();
+    return replace();
+  }
+
+private:
+  // Returns false if the existing file was left untouched.
+  bool updateInPlace() {
+    using namespace sys::fs;
+    int FD;
+    // This fails with ETXTBSY for a running executable.
+    if (openFileForReadWrite(FinalPath, FD, CD_OpenExisting, OF_None))
+      return false;
+    auto CloseFD =
+        make_scope_exit([&] { sys::Process::SafelyCloseFileDescriptor(FD); });
+
+    file_status Stat;
+    if (status(FD, Stat) || Stat.type() != file_type::regular_file ||
+        Stat.getSize() != BufferSize || Stat.getLinkCount() != 1)
+      return false;
+    if (!acquireWriteLease(FD))
+      return false;
+    auto ReleaseLease = make_scope_exit([&] { releaseWriteLease(FD); });
+
+    std::error_code EC;
+    mapped_file_region Existing(convertFDToNativeFile(FD),
+                                mapped_file_region::readwrite, BufferSize, 0,
+                                EC);
+    if (EC)
+      return false;
+
+    // Compare page-sized chunks and only store the ones that changed, so
+    // that the kernel writes back nothing but the modified pages.
+    const size_t ChunkSize = sys::Process::getPageSizeEstimate();
+    const uint8_t *Src = getBufferStart();
+    uint8_t *Dst = (uint8_t *)Existing.data();
+    for (size_t I = 0; I < BufferSize; I += ChunkSize) {
+      size_t Len = std::min(ChunkSize, BufferSize - I);
+      if (memcmp(Dst + I, Src + I, Len) != 0)
+        memcpy(Dst + I, Src + I, Len);
+    }
+    Existing.unmap();
+
+    // Give the file the permissions a newly created output would have, for
+    // example after the previous output was not executable. Replacing the
+    // file is still correct if this fails.
+    return !setPermissions(FD, static_cast<perms>(Mode & ~getUmask()));
+  }
+
+  // Write the buffer to a temporary file and rename it over the output.
+  Error replace() {
+    Expected<fs::TempFile> TempOrErr =
+        fs::TempFile::create(FinalPath + ".tmp%%%%%%%", Mode);
+    if (!TempOrErr)
+      return TempOrErr.takeError();
+    fs::TempFile Temp = std::move(*TempOrErr);
+    {
+      raw_fd_ostream OS(Temp.FD, /*shouldClose=*/false, /*unbuffered=*/true);
+      OS.write((const char *)Buffer.base(), BufferSize);
+      if (std::error_code EC = OS.error()) {
+        OS.clear_error();
+        consumeError(Temp.discard());
+        return errorCodeToError(EC);
+      }
+    }
+    return Temp.keep(FinalPath);
+  }
+
+  OwningMemoryBlock Buffer;
+  size_t BufferSize;
+  unsigned Mode;
+};
 } // namespace
 
 static Expected<std::unique_ptr<InMemoryBuffer>>
@@ -184,6 +321,16 @@ FileOutputBuffer::create(StringRef Path, size_t Size, unsigned Flags) {
   case fs::file_type::directory_file:
     return errorCodeToError(errc::is_a_directory);
   case fs::file_type::regular_file:
+    if ((Flags & F_update_in_place) && Stat.getSize() == Size &&
+        Stat.getLinkCount() == 1) {
+      std::error_code EC;
+      MemoryBlock MB = Memory::allocateMappedMemory(
+          Size, nullptr, sys::Memory::MF_READ | sys::Memory::MF_WRITE, EC);
+      if (EC)
+        return errorCodeToError(EC);
+      return std::make_unique<InPlaceUpdateBuffer>(Path, MB, Size, Mode);
+    }
+    [[fallthrough]];
   case fs::file_type::file_not_found:
   case fs::file_type::status_error:
     if (Flags & F_no_mmap)
@@ -0,0 +1,51 @@
+//===- HugePageAllocator.cpp - Huge page slab allocator -------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/HugePageAllocator.h"
+#include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/Memory.h"
+#include "llvm/Support/Process.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+#include <cassert>
+
+using namespace llvm;
+
+void *HugePageAllocator::Allocate(size_t Size, size_t Alignment) {
+  assert(Alignment <= sys::Process::getPageSizeEstimate() &&
+         "Alignment is larger than the page size");
+  std::error_code EC;
+  sys::MemoryBlock Block = sys::Memory::allocateMappedMemory(
+      Size, nullptr,
+      sys::Memory::MF_READ | sys::Memory::MF_WRITE |
+          sys::Memory::MF_HUGE_HINT,
+      EC);
+  if (EC || !Block.base())
+    report_bad_alloc_error("Allocation failed");
+  BytesMapped += Block.allocatedSize();
+  PeakBytesMapped = std::max(PeakBytesMapped, BytesMapped);
+  ++NumBlocks;
+  return Block.base();
+}
+
+void HugePageAllocator::Deallocate(const void *Ptr, size_t Size,
+                                   size_t /*Alignment*/) {
+  // allocateMappedMemory rounds the size up to whole pages, and munmap does
+  // the same, so the requested size describes the whole mapping.
+  size_t PageSize = sys::Process::getPageSizeEstimate();
+  sys::MemoryBlock Block(const_cast<void *>(Ptr), alignTo(Size, PageSize));
+  BytesMapped -= Block.allocatedSize();
+  --NumBlocks;
+  sys::Memory::releaseMappedMemory(Block);
+}
+
+void HugePageAllocator::PrintStats() const {
+  errs() << "\nNumber of mapped blocks: " << NumBlocks << '\n';
+  errs() << "Bytes mapped: " << BytesMapped << '\n';
+  errs() << "Peak bytes mapped: " << PeakBytesMapped << '\n';
+}
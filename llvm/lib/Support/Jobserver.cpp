@@ -0,0 +1,119 @@
+//===- llvm/Support/Jobserver.cpp - GNU make jobserver client -------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements the client side of the GNU make jobserver protocol.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/Jobserver.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/Process.h"
+#include <algorithm>
+#include <memory>
+#include <optional>
+
+using namespace llvm;
+
+JobserverConfig llvm::parseJobserverMakeFlags(StringRef MakeFlags) {
+  JobserverConfig Config;
+  SmallVector<StringRef, 8> Words;
+  MakeFlags.split(Words, ' ', /*MaxSplit=*/-1, /*KeepEmpty=*/false);
+  for (StringRef Value : Words) {
+    if (!Value.consume_front("--jobserver-auth=") &&
+        !Value.consume_front("--jobserver-fds="))
+      continue;
+
+    Config = JobserverConfig();
+    if (Value.consume_front("fifo:")) {
+      if (!Value.empty()) {
+        Config.Mode = JobserverConfig::Fifo;
+        Config.Path = Value.str();
+      }
+      continue;
+    }
+    // make passes negative descriptors when the jobserver is unavailable to
+    // this recipe.
+    auto [R, W] = Value.split(',');
+    int ReadFD, WriteFD;
+    if (R.getAsInteger(10, ReadFD) || W.getAsInteger(10, WriteFD) ||
+        ReadFD < 0 || WriteFD < 0)
+      continue;
+    Config.Mode = JobserverConfig::Pipe;
+    Config.ReadFD = ReadFD;
+    Config.WriteFD = WriteFD;
+  }
+  return Config;
+}
+
+// Include the platform-specific parts of this class.
+#ifdef LLVM_ON_UNIX
+#include "Unix/Jobserver.inc"
+#else
+// The Windows jobserver uses a named semaphore, which is not supported yet.
+static bool openJobserver(const JobserverConfig &, int &, int &, bool &,
+                          bool &) {
+  return false;
+}
+static bool tryReadToken(int, char &) { return false; }
+static void writeTokens(int, StringRef) {}
+static void closeFD(int) {}
+#endif
+
+JobserverClient::JobserverClient(const JobserverConfig &Config) {
+  if (!openJobserver(Config, ReadFD, WriteFD, OwnsReadFD, OwnsWriteFD)) {
+    ReadFD = WriteFD = -1;
+    OwnsReadFD = OwnsWriteFD = false;
+  }
+}
+
+JobserverClient::~JobserverClient() {
+  if (!Tokens.empty())
+    writeTokens(WriteFD, Tokens);
+  if (OwnsReadFD)
+    closeFD(ReadFD);
+  if (OwnsWriteFD && WriteFD != ReadFD)
+    closeFD(WriteFD);
+}
+
+namespace {
+/// Owns the process-wide client, if MAKEFLAGS describes a usable jobserver.
+struct JobserverInstance {
+  std::unique_ptr<JobserverClient> Client;
+
+  JobserverInstance() {
+    std::optional<std::string> MakeFlags = sys::Process::GetEnv("MAKEFLAGS");
+    if (!MakeFlags)
+      return;
+    JobserverConfig Config = parseJobserverMakeFlags(*MakeFlags);
+    if (Config.Mode == JobserverConfig::None)
+      return;
+    Client = std::make_unique<JobserverClient>(Config);
+    if (!Client->isValid())
+      Client.reset();
+  }
+};
+} // namespace
+
+JobserverClient *JobserverClient::getInstance() {
+  static ManagedStatic<JobserverInstance> Instance;
+  return Instance->Client.get();
+}
+
+unsigned JobserverClient::reserveSlots(unsigned MaxSlots) {
+  if (MaxSlots <= 1)
+    return 1;
+  std::lock_guard<std::mutex> Lock(Mutex);
+  if (!Reserved && isValid()) {
+    Reserved = true;
+    char Token;
+    while (Tokens.size() + 1 < MaxSlots && tryReadToken(ReadFD, Token))
+      Tokens.push_back(Token);
+  }
+  return std::min<unsigned>(MaxSlots, Tokens.size() + 1);
+}
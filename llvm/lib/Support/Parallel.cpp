@@ -17,7 +17,8 @@
 #include <thread>
 #include <vector>
 
-llvm::ThreadPoolStrategy llvm::parallel::strategy;
+llvm::ThreadPoolStrategy llvm::parallel::strategy =
+    llvm::hardware_concurrency();
 
 namespace llvm {
 namespace parallel {
@@ -255,3 +256,27 @@ void llvm::parallelFor(size_t Begin, size_t End,
   for (; Begin != End; ++Begin)
     Fn(Begin);
 }
+
+llvm::Error llvm::parallelForFirstError(size_t Begin, size_t End,
+                                        function_ref<Error(size_t)> Fn,
+                                        size_t *ErrorIdx) {
+  std::mutex Mutex;
+  size_t FirstIdx = End;
+  Error FirstErr = Error::success();
+  parallelFor(Begin, End, [&](size_t I) {
+    Error Err = Fn(I);
+    if (!Err)
+      return;
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (I < FirstIdx) {
+      FirstIdx = I;
+      consumeError(std::move(FirstErr));
+      FirstErr = std::move(Err);
+    } else {
+      consumeError(std::move(Err));
+    }
+  });
+  if (ErrorIdx)
+    *ErrorIdx = FirstIdx;
+  return FirstErr;
+}
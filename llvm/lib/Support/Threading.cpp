@@ -14,6 +14,7 @@
 #include "llvm/Support/Threading.h"
 #include "llvm/Config/config.h"
 #include "llvm/Config/llvm-config.h"
+#include "llvm/Support/Jobserver.h"
 
 #include <cassert>
 #include <errno.h>
@@ -57,11 +58,14 @@ unsigned llvm::ThreadPoolStrategy::compute_thread_count() const {
       UseHyperThreads ? computeHostNumHardwareThreads() : get_physical_cores();
   if (MaxThreadCount <= 0)
     MaxThreadCount = 1;
-  if (ThreadsRequested == 0)
-    return MaxThreadCount;
-  if (!Limit)
-    return ThreadsRequested;
-  return std::min((unsigned)MaxThreadCount, ThreadsRequested);
+  unsigned Count = MaxThreadCount;
+  if (ThreadsRequested != 0)
+    Count = Limit ? std::min((unsigned)MaxThreadCount, ThreadsRequested)
+                  : ThreadsRequested;
+  if (UseJobserver)
+    if (JobserverClient *Jobserver = JobserverClient::getInstance())
+      return Jobserver->reserveSlots(Count);
+  return Count;
 }
 
 // Include the platform-specific parts of this class.
@@ -97,8 +101,12 @@ const std::optional<unsigned> llvm::thread::DefaultStackSize;
 
 std::optional<ThreadPoolStrategy>
 llvm::get_threadpool_strategy(StringRef Num, ThreadPoolStrategy Default) {
-  if (Num == "all")
-    return llvm::hardware_concurrency();
+  if (Num == "all") {
+    // An explicit request for all hardware threads overrides the jobserver.
+    ThreadPoolStrategy S = llvm::hardware_concurrency();
+    S.UseJobserver = false;
+    return S;
+  }
   if (Num.empty())
     return Default;
   unsigned V;
@@ -112,5 +120,6 @@ llvm::get_threadpool_strategy(StringRef Num, ThreadPoolStrategy Default) {
   // threads on the cmd-line.
   ThreadPoolStrategy S = llvm::hardware_concurrency();
   S.ThreadsRequested = V;
+  S.UseJobserver = false;
   return S;
 }
@@ -19,8 +19,10 @@
 #include "llvm/Support/Process.h"
 #include "llvm/Support/Threading.h"
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -50,6 +52,10 @@ TimeTraceProfilerInstances &getTimeTraceProfilerInstances() {
 
 } // anonymous namespace
 
+// Memory limit for the events recorded by each new instance, in bytes.
+static std::atomic<size_t> TimeTraceMemoryLimit{0};
+static std::atomic<bool> TimeTraceDetailSummary{false};
+
 // Per Thread instance
 static LLVM_THREAD_LOCAL TimeTraceProfiler *TimeTraceProfilerInstance = nullptr;
 
@@ -100,7 +106,11 @@ struct llvm::TimeTraceProfiler {
   TimeTraceProfiler(unsigned TimeTraceGranularity = 0, StringRef ProcName = "")
       : BeginningOfTime(system_clock::now()), StartTime(ClockType::now()),
         ProcName(ProcName), Pid(sys::Process::getProcessId()),
-        Tid(llvm::get_threadid()), TimeTraceGranularity(TimeTraceGranularity) {
+        Tid(llvm::get_threadid()), TimeTraceGranularity(TimeTraceGranularity),
+        EventGranularity(TimeTraceGranularity),
+        MemoryLimit(TimeTraceMemoryLimit.load(std::memory_order_relaxed)),
+        CollectDetails(
+            TimeTraceDetailSummary.load(std::memory_order_relaxed)) {
     llvm::get_thread_name(ThreadName);
   }
 
@@ -125,9 +135,13 @@ struct llvm::TimeTraceProfiler {
     // Calculate duration at full precision for overall counts.
     DurationType Duration = E.End - E.Start;
 
-    // Only include sections longer or equal to TimeTraceGranularity msec.
-    if (duration_cast<microseconds>(Duration).count() >= TimeTraceGranularity)
+    // Only include sections longer or equal to EventGranularity msec.
+    if (duration_cast<microseconds>(Duration).count() >= EventGranularity) {
       Entries.emplace_back(E);
+      EntriesBytes += getEntryBytes(E);
+      if (MemoryLimit && EntriesBytes > MemoryLimit)
+        coarsenEntries();
+    }
 
     // Track total time taken by each "name", but only the topmost levels of
     // them; e.g. if there's a template instantiation that instantiates other
@@ -143,12 +157,55 @@ struct llvm::TimeTraceProfiler {
       CountAndTotal.second += Duration;
     };
 
+    // Same for each (name, detail) pair, which attributes time to individual
+    // headers, templates, passes etc. for the summary.
+    if (CollectDetails && !E.Detail.empty() &&
+        llvm::none_of(llvm::drop_begin(llvm::reverse(Stack)),
+                      [&](const std::unique_ptr<TimeTraceProfilerEntry> &Val) {
+                        return Val->Name == E.Name && Val->Detail == E.Detail;
+                      })) {
+      auto &CountAndTotal = CountAndTotalPerDetail[getDetailKey(E)];
+      CountAndTotal.first++;
+      CountAndTotal.second += Duration;
+    }
+
     llvm::erase_if(Stack,
                    [&](const std::unique_ptr<TimeTraceProfilerEntry> &Val) {
                      return Val.get() == &E;
                    });
   }
 
+  static size_t getEntryBytes(const TimeTraceProfilerEntry &E) {
+    return sizeof(E) + E.Name.capacity() + E.Detail.capacity();
+  }
+
+  // Drop the shortest recorded events until they use at most half of the
+  // memory limit, so that this does not happen again for a while. Parents are
+  // at least as long as their children, so the remaining events still nest.
+  void coarsenEntries() {
+    while (EntriesBytes > MemoryLimit / 2 &&
+           EventGranularity <= std::numeric_limits<unsigned>::max() / 2) {
+      EventGranularity = std::max(1u, EventGranularity * 2);
+      SmallVector<TimeTraceProfilerEntry, 0> Kept;
+      size_t KeptBytes = 0;
+      for (TimeTraceProfilerEntry &E : Entries) {
+        if (duration_cast<microseconds>(E.End - E.Start).count() >=
+            EventGranularity) {
+          KeptBytes += getEntryBytes(E);
+          Kept.emplace_back(std::move(E));
+        } else {
+          ++NumDroppedEntries;
+        }
+      }
+      // The entries are not assignable, so they can not be moved into place
+      // by assigning the vector.
+      Entries.clear();
+      for (TimeTraceProfilerEntry &E : Kept)
+        Entries.emplace_back(std::move(E));
+      EntriesBytes = KeptBytes;
+    }
+  }
+
   // Write events from this TimeTraceProfilerInstance and
   // ThreadTimeTraceProfilerInstances.
   void write(raw_pwrite_stream &OS) {
@@ -282,6 +339,13 @@ struct llvm::TimeTraceProfiler {
     J.arrayEnd();
     J.attributeEnd();
 
+    // Report how many events did not fit into the memory limit.
+    size_t NumDropped = NumDroppedEntries;
+    for (const TimeTraceProfiler *TTP : Instances.List)
+      NumDropped += TTP->NumDroppedEntries;
+    if (NumDropped)
+      J.attribute("droppedEvents", int64_t(NumDropped));
+
     // Emit the absolute time when this TimeProfiler started.
     // This can be used to combine the profiling data from
     // multiple processes and preserve actual time intervals.
@@ -293,9 +357,85 @@ struct llvm::TimeTraceProfiler {
     J.objectEnd();
   }
 
+  // Write the per-name and per-(name, detail) totals of this
+  // TimeTraceProfilerInstance and ThreadTimeTraceProfilerInstances.
+  void writeSummary(raw_pwrite_stream &OS) {
+    auto &Instances = getTimeTraceProfilerInstances();
+    std::lock_guard<std::mutex> Lock(Instances.Lock);
+    assert(Stack.empty() &&
+           "All profiler sections should be ended when calling writeSummary");
+
+    auto combine = [](StringMap<CountAndDurationType> &All,
+                      const StringMap<CountAndDurationType> &Stats) {
+      for (const auto &Stat : Stats) {
+        auto &CountAndTotal = All[Stat.getKey()];
+        CountAndTotal.first += Stat.getValue().first;
+        CountAndTotal.second += Stat.getValue().second;
+      }
+    };
+    StringMap<CountAndDurationType> AllPerName, AllPerDetail;
+    combine(AllPerName, CountAndTotalPerName);
+    combine(AllPerDetail, CountAndTotalPerDetail);
+    for (const TimeTraceProfiler *TTP : Instances.List) {
+      combine(AllPerName, TTP->CountAndTotalPerName);
+      combine(AllPerDetail, TTP->CountAndTotalPerDetail);
+    }
+
+    using StatType = std::pair<StringRef, CountAndDurationType>;
+    auto sortedByTotal = [](const StringMap<CountAndDurationType> &Map,
+                            DurationType MinDuration) {
+      std::vector<StatType> Sorted;
+      for (const auto &Stat : Map)
+        if (Stat.getValue().second >= MinDuration)
+          Sorted.emplace_back(Stat.getKey(), Stat.getValue());
+      llvm::sort(Sorted, [](const StatType &A, const StatType &B) {
+        return A.second.second > B.second.second;
+      });
+      return Sorted;
+    };
+
+    json::OStream J(OS);
+    J.object([&] {
+      J.attribute("beginningOfTime",
+                  time_point_cast<microseconds>(BeginningOfTime)
+                      .time_since_epoch()
+                      .count());
+      J.attributeArray("totals", [&] {
+        for (const StatType &Stat : sortedByTotal(AllPerName, {}))
+          J.object([&] {
+            J.attribute("name", Stat.first);
+            J.attribute("count", int64_t(Stat.second.first));
+            J.attribute(
+                "us",
+                duration_cast<microseconds>(Stat.second.second).count());
+          });
+      });
+      J.attributeArray("details", [&] {
+        for (const StatType &Stat :
+             sortedByTotal(AllPerDetail, microseconds(TimeTraceGranularity))) {
+          auto [Name, Detail] = Stat.first.split('\0');
+          J.object([&] {
+            J.attribute("name", Name);
+            J.attribute("detail", Detail);
+            J.attribute("count", int64_t(Stat.second.first));
+            J.attribute(
+                "us",
+                duration_cast<microseconds>(Stat.second.second).count());
+          });
+        }
+      });
+    });
+  }
+
+  static std::string getDetailKey(const TimeTraceProfilerEntry &E) {
+    return E.Name + '\0' + E.Detail;
+  }
+
   SmallVector<std::unique_ptr<TimeTraceProfilerEntry>, 16> Stack;
   SmallVector<TimeTraceProfilerEntry, 128> Entries;
   StringMap<CountAndDurationType> CountAndTotalPerName;
+  // Keyed by the name and detail separated by a NUL character.
+  StringMap<CountAndDurationType> CountAndTotalPerDetail;
   // System clock time when the session was begun.
   const time_point<system_clock> BeginningOfTime;
   // Profiling clock time when the session was begun.
@@ -307,8 +447,25 @@ struct llvm::TimeTraceProfiler {
 
   // Minimum time granularity (in microseconds)
   const unsigned TimeTraceGranularity;
+  // Minimum duration of recorded events (in microseconds). Starts out as
+  // TimeTraceGranularity and grows when the memory limit is exceeded.
+  unsigned EventGranularity;
+  // Approximate limit for the memory used by Entries, or 0 for no limit.
+  const size_t MemoryLimit;
+  size_t EntriesBytes = 0;
+  size_t NumDroppedEntries = 0;
+  // Whether to collect CountAndTotalPerDetail.
+  const bool CollectDetails;
 };
 
+void llvm::timeTraceProfilerSetMemoryLimit(size_t Bytes) {
+  TimeTraceMemoryLimit.store(Bytes, std::memory_order_relaxed);
+}
+
+void llvm::timeTraceProfilerSetDetailSummary(bool Enable) {
+  TimeTraceDetailSummary.store(Enable, std::memory_order_relaxed);
+}
+
 void llvm::timeTraceProfilerInitialize(unsigned TimeTraceGranularity,
                                        StringRef ProcName) {
   assert(TimeTraceProfilerInstance == nullptr &&
@@ -345,6 +502,12 @@ void llvm::timeTraceProfilerWrite(raw_pwrite_stream &OS) {
   TimeTraceProfilerInstance->write(OS);
 }
 
+void llvm::timeTraceProfilerWriteSummary(raw_pwrite_stream &OS) {
+  assert(TimeTraceProfilerInstance != nullptr &&
+         "Profiler object can't be null");
+  TimeTraceProfilerInstance->writeSummary(OS);
+}
+
 Error llvm::timeTraceProfilerWrite(StringRef PreferredFileName,
                                    StringRef FallbackFileName) {
   assert(TimeTraceProfilerInstance != nullptr &&
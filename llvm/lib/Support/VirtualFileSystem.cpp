@@ -611,6 +611,88 @@ directory_iterator OverlayFileSystem::dir_begin(const Twine &Dir,
 
 void ProxyFileSystem::anchor() {}
 
+//===-----------------------------------------------------------------------===/
+// StatCachingFileSystem implementation
+//===-----------------------------------------------------------------------===/
+
+ErrorOr<Status> StatCachingFileSystem::getCachedStatus(StringRef AbsPath) {
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    auto I = Cache.find(AbsPath);
+    if (I != Cache.end()) {
+      ++NumHits;
+      return I->second;
+    }
+  }
+
+  // Do not hold the lock while going to the file system. Two threads may
+  // then stat the same path, but they get the same answer.
+  ErrorOr<Status> S = getUnderlyingFS().status(AbsPath);
+  std::lock_guard<std::mutex> Lock(Mutex);
+  ++NumMisses;
+  return Cache.try_emplace(AbsPath, S).first->second;
+}
+
+ErrorOr<Status> StatCachingFileSystem::status(const Twine &Path) {
+  SmallString<256> AbsPath;
+  Path.toVector(AbsPath);
+  if (makeAbsolute(AbsPath))
+    return ProxyFileSystem::status(Path);
+  ErrorOr<Status> S = getCachedStatus(AbsPath);
+  if (!S)
+    return S.getError();
+  return Status::copyWithNewName(*S, Path);
+}
+
+bool StatCachingFileSystem::exists(const Twine &Path) {
+  return static_cast<bool>(status(Path));
+}
+
+ErrorOr<std::unique_ptr<File>>
+StatCachingFileSystem::openFileForRead(const Twine &Path) {
+  SmallString<256> AbsPath;
+  Path.toVector(AbsPath);
+  if (!makeAbsolute(AbsPath)) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    auto I = Cache.find(AbsPath);
+    if (I != Cache.end() && !I->second) {
+      ++NumHits;
+      return I->second.getError();
+    }
+  }
+  return ProxyFileSystem::openFileForRead(Path);
+}
+
+void StatCachingFileSystem::invalidate(const Twine &Path) {
+  SmallString<256> AbsPath;
+  Path.toVector(AbsPath);
+  if (makeAbsolute(AbsPath))
+    return;
+  std::lock_guard<std::mutex> Lock(Mutex);
+  Cache.erase(AbsPath);
+}
+
+void StatCachingFileSystem::clear() {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  Cache.clear();
+}
+
+void StatCachingFileSystem::printImpl(raw_ostream &OS, PrintType Type,
+                                      unsigned IndentLevel) const {
+  printIndent(OS, IndentLevel);
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    OS << "StatCachingFileSystem (" << Cache.size() << " entries, " << NumHits
+       << " hits, " << NumMisses << " misses)\n";
+  }
+  if (Type == PrintType::Summary)
+    return;
+
+  if (Type == PrintType::Contents)
+    Type = PrintType::Summary;
+  getUnderlyingFS().print(OS, Type, IndentLevel + 1);
+}
+
 namespace llvm {
 namespace vfs {
 
@@ -2948,5 +3030,6 @@ recursive_directory_iterator::increment(std::error_code &EC) {
 const char FileSystem::ID = 0;
 const char OverlayFileSystem::ID = 0;
 const char ProxyFileSystem::ID = 0;
+const char StatCachingFileSystem::ID = 0;
 const char InMemoryFileSystem::ID = 0;
 const char RedirectingFileSystem::ID = 0;
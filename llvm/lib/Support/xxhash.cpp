@@ -47,6 +47,15 @@
 
 #include <stdlib.h>
 
+#if defined(__SSE2__) || (defined(_M_X64) && !defined(_M_ARM64EC))
+#define LLVM_XXH_USE_SSE2
+#include <emmintrin.h>
+#elif (defined(__aarch64__) || defined(_M_ARM64) || defined(_M_ARM64EC)) &&   \
+    defined(__ARM_NEON) && !defined(__AARCH64EB__)
+#define LLVM_XXH_USE_NEON
+#include <arm_neon.h>
+#endif
+
 using namespace llvm;
 using namespace support;
 
@@ -323,9 +332,9 @@ static uint64_t XXH3_len_129to240_64b(const uint8_t *input, size_t len,
   return XXH3_avalanche(acc);
 }
 
-LLVM_ATTRIBUTE_ALWAYS_INLINE
-static void XXH3_accumulate_512_scalar(uint64_t *acc, const uint8_t *input,
-                                       const uint8_t *secret) {
+[[maybe_unused]] LLVM_ATTRIBUTE_ALWAYS_INLINE static void
+XXH3_accumulate_512_scalar(uint64_t *acc, const uint8_t *input,
+                           const uint8_t *secret) {
   for (size_t i = 0; i < XXH_ACC_NB; ++i) {
     uint64_t data_val = endian::read64le(input + 8 * i);
     uint64_t data_key = data_val ^ endian::read64le(secret + 8 * i);
@@ -334,15 +343,72 @@ static void XXH3_accumulate_512_scalar(uint64_t *acc, const uint8_t *input,
   }
 }
 
+#if defined(LLVM_XXH_USE_SSE2)
+// SSE2 is part of the x86-64 baseline, so no runtime dispatch is needed. Each
+// vector holds the lane pair (2i, 2i+1) that the scalar code cross-adds.
 LLVM_ATTRIBUTE_ALWAYS_INLINE
-static void XXH3_accumulate_scalar(uint64_t *acc, const uint8_t *input,
-                                   const uint8_t *secret, size_t nbStripes) {
-  for (size_t n = 0; n < nbStripes; ++n)
-    XXH3_accumulate_512_scalar(acc, input + n * XXH_STRIPE_LEN,
-                               secret + n * XXH_SECRET_CONSUME_RATE);
+static void XXH3_accumulate_512_sse2(uint64_t *acc, const uint8_t *input,
+                                     const uint8_t *secret) {
+  __m128i *const xacc = reinterpret_cast<__m128i *>(acc);
+  for (size_t i = 0; i < XXH_ACC_NB / 2; ++i) {
+    __m128i data_vec =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(input) + i);
+    __m128i key_vec =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(secret) + i);
+    __m128i data_key = _mm_xor_si128(data_vec, key_vec);
+    __m128i data_key_hi = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+    __m128i product = _mm_mul_epu32(data_key, data_key_hi);
+    __m128i data_swap = _mm_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+    xacc[i] = _mm_add_epi64(_mm_add_epi64(xacc[i], data_swap), product);
+  }
 }
 
-static void XXH3_scrambleAcc(uint64_t *acc, const uint8_t *secret) {
+static void XXH3_scrambleAcc_sse2(uint64_t *acc, const uint8_t *secret) {
+  __m128i *const xacc = reinterpret_cast<__m128i *>(acc);
+  const __m128i prime32 = _mm_set1_epi32(int(PRIME32_1));
+  for (size_t i = 0; i < XXH_ACC_NB / 2; ++i) {
+    __m128i acc_vec = _mm_xor_si128(xacc[i], _mm_srli_epi64(xacc[i], 47));
+    __m128i key_vec =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(secret) + i);
+    __m128i data_key = _mm_xor_si128(acc_vec, key_vec);
+    __m128i data_key_hi = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+    __m128i prod_lo = _mm_mul_epu32(data_key, prime32);
+    __m128i prod_hi = _mm_mul_epu32(data_key_hi, prime32);
+    xacc[i] = _mm_add_epi64(prod_lo, _mm_slli_epi64(prod_hi, 32));
+  }
+}
+#elif defined(LLVM_XXH_USE_NEON)
+// NEON is part of the AArch64 baseline, so no runtime dispatch is needed.
+LLVM_ATTRIBUTE_ALWAYS_INLINE
+static void XXH3_accumulate_512_neon(uint64_t *acc, const uint8_t *input,
+                                     const uint8_t *secret) {
+  uint64x2_t *const xacc = reinterpret_cast<uint64x2_t *>(acc);
+  for (size_t i = 0; i < XXH_ACC_NB / 2; ++i) {
+    uint64x2_t data_vec = vreinterpretq_u64_u8(vld1q_u8(input + 16 * i));
+    uint64x2_t key_vec = vreinterpretq_u64_u8(vld1q_u8(secret + 16 * i));
+    uint64x2_t data_key = veorq_u64(data_vec, key_vec);
+    uint64x2_t data_swap = vextq_u64(data_vec, data_vec, 1);
+    uint64x2_t sum = vaddq_u64(xacc[i], data_swap);
+    xacc[i] = vmlal_u32(sum, vmovn_u64(data_key), vshrn_n_u64(data_key, 32));
+  }
+}
+
+static void XXH3_scrambleAcc_neon(uint64_t *acc, const uint8_t *secret) {
+  uint64x2_t *const xacc = reinterpret_cast<uint64x2_t *>(acc);
+  for (size_t i = 0; i < XXH_ACC_NB / 2; ++i) {
+    uint64x2_t acc_vec = veorq_u64(xacc[i], vshrq_n_u64(xacc[i], 47));
+    uint64x2_t key_vec = vreinterpretq_u64_u8(vld1q_u8(secret + 16 * i));
+    uint64x2_t data_key = veorq_u64(acc_vec, key_vec);
+    // There is no 64x64 bit multiply; split it into two 32x32 bit ones.
+    uint64x2_t prod_hi =
+        vshlq_n_u64(vmull_n_u32(vshrn_n_u64(data_key, 32), PRIME32_1), 32);
+    xacc[i] = vmlal_n_u32(prod_hi, vmovn_u64(data_key), PRIME32_1);
+  }
+}
+#endif
+
+[[maybe_unused]] static void XXH3_scrambleAcc_scalar(uint64_t *acc,
+                                                     const uint8_t *secret) {
   for (size_t i = 0; i < XXH_ACC_NB; ++i) {
     acc[i] ^= acc[i] >> 47;
     acc[i] ^= endian::read64le(secret + 8 * i);
@@ -350,6 +416,38 @@ static void XXH3_scrambleAcc(uint64_t *acc, const uint8_t *secret) {
   }
 }
 
+/// \p acc must be 16 byte aligned.
+LLVM_ATTRIBUTE_ALWAYS_INLINE
+static void XXH3_accumulate_512(uint64_t *acc, const uint8_t *input,
+                                const uint8_t *secret) {
+#if defined(LLVM_XXH_USE_SSE2)
+  XXH3_accumulate_512_sse2(acc, input, secret);
+#elif defined(LLVM_XXH_USE_NEON)
+  XXH3_accumulate_512_neon(acc, input, secret);
+#else
+  XXH3_accumulate_512_scalar(acc, input, secret);
+#endif
+}
+
+LLVM_ATTRIBUTE_ALWAYS_INLINE
+static void XXH3_accumulate(uint64_t *acc, const uint8_t *input,
+                            const uint8_t *secret, size_t nbStripes) {
+  for (size_t n = 0; n < nbStripes; ++n)
+    XXH3_accumulate_512(acc, input + n * XXH_STRIPE_LEN,
+                        secret + n * XXH_SECRET_CONSUME_RATE);
+}
+
+/// \p acc must be 16 byte aligned.
+static void XXH3_scrambleAcc(uint64_t *acc, const uint8_t *secret) {
+#if defined(LLVM_XXH_USE_SSE2)
+  XXH3_scrambleAcc_sse2(acc, secret);
+#elif defined(LLVM_XXH_USE_NEON)
+  XXH3_scrambleAcc_neon(acc, secret);
+#else
+  XXH3_scrambleAcc_scalar(acc, secret);
+#endif
+}
+
 static uint64_t XXH3_mix2Accs(const uint64_t *acc, const uint8_t *secret) {
   return XXH3_mul128_fold64(acc[0] ^ endian::read64le(secret),
                             acc[1] ^ endian::read64le(secret + 8));
@@ -375,21 +473,20 @@ static uint64_t XXH3_hashLong_64b(const uint8_t *input, size_t len,
       PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1,
   };
   for (size_t n = 0; n < nb_blocks; ++n) {
-    XXH3_accumulate_scalar(acc, input + n * block_len, secret,
-                           nbStripesPerBlock);
+    XXH3_accumulate(acc, input + n * block_len, secret, nbStripesPerBlock);
     XXH3_scrambleAcc(acc, secret + secretSize - XXH_STRIPE_LEN);
   }
 
   /* last partial block */
   const size_t nbStripes = (len - 1 - (block_len * nb_blocks)) / XXH_STRIPE_LEN;
   assert(nbStripes <= secretSize / XXH_SECRET_CONSUME_RATE);
-  XXH3_accumulate_scalar(acc, input + nb_blocks * block_len, secret, nbStripes);
+  XXH3_accumulate(acc, input + nb_blocks * block_len, secret, nbStripes);
 
   /* last stripe */
   constexpr size_t XXH_SECRET_LASTACC_START = 7;
-  XXH3_accumulate_512_scalar(acc, input + len - XXH_STRIPE_LEN,
-                             secret + secretSize - XXH_STRIPE_LEN -
-                                 XXH_SECRET_LASTACC_START);
+  XXH3_accumulate_512(acc, input + len - XXH_STRIPE_LEN,
+                      secret + secretSize - XXH_STRIPE_LEN -
+                          XXH_SECRET_LASTACC_START);
 
   /* converge into final hash */
   constexpr size_t XXH_SECRET_MERGEACCS_START = 11;
@@ -851,21 +948,20 @@ XXH3_hashLong_128b(const uint8_t *input, size_t len, const uint8_t *secret,
   };
 
   for (size_t n = 0; n < nb_blocks; ++n) {
-    XXH3_accumulate_scalar(acc, input + n * block_len, secret,
-                           nbStripesPerBlock);
+    XXH3_accumulate(acc, input + n * block_len, secret, nbStripesPerBlock);
     XXH3_scrambleAcc(acc, secret + secretSize - XXH_STRIPE_LEN);
   }
 
   /* last partial block */
   const size_t nbStripes = (len - 1 - (block_len * nb_blocks)) / XXH_STRIPE_LEN;
   assert(nbStripes <= secretSize / XXH_SECRET_CONSUME_RATE);
-  XXH3_accumulate_scalar(acc, input + nb_blocks * block_len, secret, nbStripes);
+  XXH3_accumulate(acc, input + nb_blocks * block_len, secret, nbStripes);
 
   /* last stripe */
   constexpr size_t XXH_SECRET_LASTACC_START = 7;
-  XXH3_accumulate_512_scalar(acc, input + len - XXH_STRIPE_LEN,
-                             secret + secretSize - XXH_STRIPE_LEN -
-                                 XXH_SECRET_LASTACC_START);
+  XXH3_accumulate_512(acc, input + len - XXH_STRIPE_LEN,
+                      secret + secretSize - XXH_STRIPE_LEN -
+                          XXH_SECRET_LASTACC_START);
 
   /* converge into final hash */
   static_assert(sizeof(acc) == 64);
@@ -67,6 +67,12 @@ static cl::opt<bool> NoWarnOnUnusedTemplateArgs(
     "no-warn-on-unused-template-args",
     cl::desc("Disable unused template argument warnings."));
 
+static cl::list<std::string> ExtraOutputs(
+    "extra-output",
+    cl::desc("Also run the backend <action> on the parsed records and write "
+             "its output to <file>"),
+    cl::value_desc("action=file"));
+
 static int reportError(const char *ProgName, Twine Msg) {
   errs() << ProgName << ": " << Msg;
   errs().flush();
@@ -95,6 +101,66 @@ static int createDependencyFile(const TGParser &Parser, const char *argv0) {
   return 0;
 }
 
+/// Write \p Contents to \p Filename, honoring `-write-if-changed`.
+static int writeOutput(const char *argv0, StringRef Filename,
+                       StringRef Contents) {
+  if (WriteIfChanged) {
+    // Only updates the real output file if there are any differences.
+    // This prevents recompilation of all the files depending on it if there
+    // aren't any.
+    if (auto ExistingOrErr = MemoryBuffer::getFile(Filename, /*IsText=*/true))
+      if (std::move(ExistingOrErr.get())->getBuffer() == Contents)
+        return 0;
+  }
+  std::error_code EC;
+  ToolOutputFile OutFile(Filename, EC, sys::fs::OF_Text);
+  if (EC)
+    return reportError(argv0, "error opening " + Filename + ": " +
+                                  EC.message() + "\n");
+  OutFile.os() << Contents;
+  if (ErrorsPrinted == 0)
+    OutFile.keep();
+  return 0;
+}
+
+/// Run the backends requested with `-extra-output` on the records that were
+/// already parsed for the main action, so that a build that needs several
+/// outputs from the same .td file only parses it once.
+static int emitExtraOutputs(const char *argv0, RecordKeeper &Records) {
+  cl::parser<TableGen::Emitter::FnT> &Parser =
+      TableGen::Emitter::Action->getParser();
+  for (StringRef Extra : ExtraOutputs) {
+    auto [Name, Filename] = Extra.split('=');
+    Name.consume_front("-");
+    if (Filename.empty())
+      return reportError(argv0, "expected <action>=<file> for -extra-output, "
+                                "got '" + Extra + "'\n");
+
+    bool Found = false;
+    for (unsigned I = 0, E = Parser.getNumOptions(); I != E && !Found; ++I)
+      Found = Parser.getOption(I) == Name;
+    TableGen::Emitter::FnT ActionFn = nullptr;
+    if (!Found ||
+        Parser.parse(*TableGen::Emitter::Action, Name, "", ActionFn) ||
+        !ActionFn)
+      return reportError(argv0, "unknown action '" + Name +
+                                    "' for -extra-output\n");
+
+    Records.startBackendTimer(("Backend " + Name).str());
+    std::string OutString;
+    raw_string_ostream Out(OutString);
+    ActionFn(Records, Out);
+    Records.stopBackendTimer();
+
+    Records.startTimer("Write output");
+    int Ret = writeOutput(argv0, Filename, Out.str());
+    Records.stopTimer();
+    if (Ret)
+      return Ret;
+  }
+  return 0;
+}
+
 int llvm::TableGenMain(const char *argv0,
                        std::function<TableGenMainFn> MainFn) {
   RecordKeeper Records;
@@ -152,28 +218,12 @@ int llvm::TableGenMain(const char *argv0,
   }
 
   Records.startTimer("Write output");
-  bool WriteFile = true;
-  if (WriteIfChanged) {
-    // Only updates the real output file if there are any differences.
-    // This prevents recompilation of all the files depending on it if there
-    // aren't any.
-    if (auto ExistingOrErr =
-            MemoryBuffer::getFile(OutputFilename, /*IsText=*/true))
-      if (std::move(ExistingOrErr.get())->getBuffer() == Out.str())
-        WriteFile = false;
-  }
-  if (WriteFile) {
-    std::error_code EC;
-    ToolOutputFile OutFile(OutputFilename, EC, sys::fs::OF_Text);
-    if (EC)
-      return reportError(argv0, "error opening " + OutputFilename + ": " +
-                                    EC.message() + "\n");
-    OutFile.os() << Out.str();
-    if (ErrorsPrinted == 0)
-      OutFile.keep();
-  }
-  
+  if (int Ret = writeOutput(argv0, OutputFilename, Out.str()))
+    return Ret;
   Records.stopTimer();
+
+  if (int Ret = emitExtraOutputs(argv0, Records))
+    return Ret;
   Records.stopPhaseTiming();
 
   if (ErrorsPrinted > 0)
@@ -75,6 +75,8 @@ STATISTIC(NumFnWithExactDefinition,
 STATISTIC(NumFnWithoutExactDefinition,
           "Number of functions without exact definitions");
 STATISTIC(NumFnShallowWrappersCreated, "Number of shallow wrappers created");
+STATISTIC(NumFnSeedingSkipped,
+          "Number of functions not seeded because they exceed the size limit");
 STATISTIC(NumAttributesTimedOut,
           "Number of abstract attributes timed out before fixpoint");
 STATISTIC(NumAttributesValidFixpoint,
@@ -116,6 +118,13 @@ static cl::opt<bool> AnnotateDeclarationCallSites(
 static cl::opt<bool> EnableHeapToStack("enable-heap-to-stack-conversion",
                                        cl::init(true), cl::Hidden);
 
+static cl::opt<unsigned> MaxSeedFunctionSize(
+    "attributor-max-seed-function-size", cl::Hidden,
+    cl::desc("Do not eagerly seed abstract attributes in functions with more "
+             "instructions than this (0 = no limit). Such functions are still "
+             "analyzed on demand."),
+    cl::init(0));
+
 static cl::opt<bool>
     AllowShallowWrappers("attributor-allow-shallow-wrappers", cl::Hidden,
                          cl::desc("Allow the Attributor to create shallow "
@@ -3905,6 +3914,15 @@ static bool runAttributorOnFunctions(InformationCache &InfoCache,
         continue;
     }
 
+    // Seeding very large functions dominates the fixpoint cost. Leave them to
+    // be queried on demand by the abstract attributes of their callers.
+    if (MaxSeedFunctionSize && F->getInstructionCount() > MaxSeedFunctionSize) {
+      LLVM_DEBUG(dbgs() << "[Attributor] Skip seeding " << F->getName()
+                        << ", too large\n");
+      ++NumFnSeedingSkipped;
+      continue;
+    }
+
     // Populate the Attributor with abstract attribute opportunities in the
     // function and the information cache with IR information.
     A.identifyDefaultAbstractAttributes(*F);
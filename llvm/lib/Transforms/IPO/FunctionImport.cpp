@@ -38,6 +38,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/JSON.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/IPO/Internalize.h"
@@ -1077,11 +1078,21 @@ void llvm::ComputeCrossModuleImport(
   // imported to the export list. We also need to mark any references and calls
   // they make as exported as well. We do this here, as it is more efficient
   // since we may import the same values multiple times into different modules
-  // during the import computation.
-  for (auto &ELI : ExportLists) {
+  // during the import computation. Each exporting module only reads the index
+  // and updates its own export list, so they are processed in parallel.
+  std::vector<std::remove_reference_t<decltype(ExportLists)>::value_type *>
+      ExportListsVec;
+  ExportListsVec.reserve(ExportLists.size());
+  for (auto &ELI : ExportLists)
+    ExportListsVec.push_back(&ELI);
+  const GVSummaryMapTy EmptyGVSummaries;
+  parallelFor(0, ExportListsVec.size(), [&](size_t I) {
+    auto &ELI = *ExportListsVec[I];
     FunctionImporter::ExportSetTy NewExports;
-    const auto &DefinedGVSummaries =
-        ModuleToDefinedGVSummaries.lookup(ELI.first);
+    auto DefinedIt = ModuleToDefinedGVSummaries.find(ELI.first);
+    const GVSummaryMapTy &DefinedGVSummaries =
+        DefinedIt == ModuleToDefinedGVSummaries.end() ? EmptyGVSummaries
+                                                      : DefinedIt->second;
     for (auto &[EI, Type] : ELI.second) {
       // If a variable is exported as a declaration, its 'refs' and 'calls' are
       // not further exported.
@@ -1135,7 +1146,7 @@ void llvm::ComputeCrossModuleImport(
         ++EI;
     }
     ELI.second.insert(NewExports.begin(), NewExports.end());
-  }
+  });
 
   assert(checkVariableImport(Index, ImportLists, ExportLists));
 #ifndef NDEBUG
@@ -385,6 +385,12 @@ static cl::opt<bool> ClOptSameTemp(
     "asan-opt-same-temp", cl::desc("Instrument the same temp just once"),
     cl::Hidden, cl::init(true));
 
+static cl::opt<bool> ClOptSameTempSinglePred(
+    "asan-opt-same-temp-single-pred",
+    cl::desc("Instrument the same temp just once across a block and its "
+             "single predecessor"),
+    cl::Hidden, cl::init(false));
+
 static cl::opt<bool> ClOptGlobals("asan-opt-globals",
                                   cl::desc("Don't instrument scalar globals"),
                                   cl::Hidden, cl::init(true));
@@ -458,6 +464,8 @@ STATISTIC(NumOptimizedAccessesToGlobalVar,
           "Number of optimized accesses to global vars");
 STATISTIC(NumOptimizedAccessesToStackVar,
           "Number of optimized accesses to stack vars");
+STATISTIC(NumOptimizedAccessesToSameTemp,
+          "Number of optimized accesses to already instrumented temps");
 
 namespace {
 
@@ -2977,8 +2985,11 @@ bool AddressSanitizer::instrumentFunction(Function &F,
   markEscapedLocalAllocas(F);
 
   // We want to instrument every address only once per basic block (unless there
-  // are calls between uses).
+  // are calls between uses). Optionally, a block whose single predecessor was
+  // the block scanned just before also inherits the set of that predecessor,
+  // as every path to it goes through those checks.
   SmallPtrSet<Value *, 16> TempsToInstrument;
+  BasicBlock *TempsBB = nullptr;
   SmallVector<InterestingMemoryOperand, 16> OperandsToInstrument;
   SmallVector<MemIntrinsic *, 16> IntrinToInstrument;
   SmallVector<Instruction *, 8> NoReturnCalls;
@@ -2988,7 +2999,10 @@ bool AddressSanitizer::instrumentFunction(Function &F,
   // Fill the set of memory operations to instrument.
   for (auto &BB : F) {
     AllBlocks.push_back(&BB);
-    TempsToInstrument.clear();
+    if (!ClOptSameTempSinglePred || !TempsBB ||
+        BB.getSinglePredecessor() != TempsBB)
+      TempsToInstrument.clear();
+    TempsBB = &BB;
     int NumInsnsPerBB = 0;
     for (auto &Inst : BB) {
       if (LooksLikeCodeInBug11395(&Inst)) return false;
@@ -3006,11 +3020,17 @@ bool AddressSanitizer::instrumentFunction(Function &F,
             // instrumented the full object. But don't add to TempsToInstrument
             // because we might get another load/store with a different mask.
             if (Operand.MaybeMask) {
-              if (TempsToInstrument.count(Ptr))
-                continue; // We've seen this (whole) temp in the current BB.
+              if (TempsToInstrument.count(Ptr)) {
+                // We've seen this (whole) temp in the current BB.
+                ++NumOptimizedAccessesToSameTemp;
+                continue;
+              }
             } else {
-              if (!TempsToInstrument.insert(Ptr).second)
-                continue; // We've seen this temp in the current BB.
+              if (!TempsToInstrument.insert(Ptr).second) {
+                // We've seen this temp in the current BB.
+                ++NumOptimizedAccessesToSameTemp;
+                continue;
+              }
             }
           }
           OperandsToInstrument.push_back(Operand);
@@ -3035,7 +3055,11 @@ bool AddressSanitizer::instrumentFunction(Function &F,
         if (CallInst *CI = dyn_cast<CallInst>(&Inst))
           maybeMarkSanitizerLibraryCallNoBuiltin(CI, TLI);
       }
-      if (NumInsnsPerBB >= ClMaxInsnsToInstrumentPerBB) break;
+      if (NumInsnsPerBB >= ClMaxInsnsToInstrumentPerBB) {
+        // The rest of the block was not scanned for calls.
+        TempsBB = nullptr;
+        break;
+      }
     }
   }
 
@@ -165,6 +165,11 @@ cl::opt<bool> IterativeCounterPromotion(
     "iterative-counter-promotion", cl::init(true),
     cl::desc("Allow counter promotion across the whole loop nest."));
 
+cl::opt<bool> SampledInstrumentation(
+    "sampled-instrumentation", cl::init(false),
+    cl::desc("Only update profile counters while the runtime sampling flag "
+             "is set"));
+
 cl::opt<bool> SkipRetExitBlock(
     "skip-ret-exit-block", cl::init(true),
     cl::desc("Suppress counter promotion if exit blocks contain ret."));
@@ -237,6 +242,9 @@ private:
   GlobalVariable *NamesVar = nullptr;
   size_t NamesSize = 0;
 
+  /// The runtime flag that guards counter updates in sampled instrumentation.
+  GlobalVariable *SamplingVar = nullptr;
+
   /// The instance of [[alwaysinline]] rmw_or(ptr, i8).
   /// This is name-insensitive.
   Function *RMWOrFunc = nullptr;
@@ -259,6 +267,10 @@ private:
   /// Returns true if profile counter update register promotion is enabled.
   bool isCounterPromotionEnabled() const;
 
+  /// Move the counter update \p I into a block that only runs while the
+  /// runtime sampling flag is set.
+  void guardBySampling(InstrProfCntrInstBase *I);
+
   /// Count the number of instrumented value sites for the function.
   void computeNumValueSiteCounts(InstrProfValueProfileInst *Ins);
 
@@ -637,6 +649,17 @@ PreservedAnalyses InstrProfilingLoweringPass::run(Module &M,
 bool InstrLowerer::lowerIntrinsics(Function *F) {
   bool MadeChange = false;
   PromotionCandidates.clear();
+  // Splitting blocks would invalidate the iteration below, so guard the
+  // counter updates up front.
+  if (SampledInstrumentation) {
+    SmallVector<InstrProfCntrInstBase *, 16> Updates;
+    for (BasicBlock &BB : *F)
+      for (Instruction &Instr : BB)
+        if (isa<InstrProfIncrementInst, InstrProfCoverInst>(Instr))
+          Updates.push_back(cast<InstrProfCntrInstBase>(&Instr));
+    for (InstrProfCntrInstBase *I : Updates)
+      guardBySampling(I);
+  }
   for (BasicBlock &BB : *F) {
     for (Instruction &Instr : llvm::make_early_inc_range(BB)) {
       if (auto *IPIS = dyn_cast<InstrProfIncrementInstStep>(&Instr)) {
@@ -690,6 +713,28 @@ bool InstrLowerer::isCounterPromotionEnabled() const {
   return Options.DoCounterPromotion;
 }
 
+void InstrLowerer::guardBySampling(InstrProfCntrInstBase *I) {
+  auto &Ctx = M.getContext();
+  Type *Int8Ty = Type::getInt8Ty(Ctx);
+  if (!SamplingVar) {
+    SamplingVar = M.getNamedGlobal(getInstrProfSamplingVarName());
+    if (!SamplingVar)
+      SamplingVar = new GlobalVariable(M, Int8Ty, /*isConstant=*/false,
+                                       GlobalValue::ExternalLinkage, nullptr,
+                                       getInstrProfSamplingVarName());
+    SamplingVar->setVisibility(GlobalVariable::HiddenVisibility);
+  }
+  IRBuilder<> Builder(I);
+  // The flag is toggled by another thread, so only atomicity is needed.
+  LoadInst *Flag = Builder.CreateLoad(Int8Ty, SamplingVar, "profsampling");
+  Flag->setAtomic(AtomicOrdering::Monotonic);
+  Flag->setAlignment(Align(1));
+  Value *Enabled = Builder.CreateIsNotNull(Flag);
+  Instruction *ThenTerm = SplitBlockAndInsertIfThen(Enabled, I->getIterator(),
+                                                    /*Unreachable=*/false);
+  I->moveBefore(ThenTerm);
+}
+
 void InstrLowerer::promoteCounterLoadStores(Function *F) {
   if (!isCounterPromotionEnabled())
     return;
@@ -193,6 +193,13 @@ static cl::opt<unsigned> EpilogueVectorizationMinVF(
     cl::desc("Only loops with vectorization factor equal to or larger than "
              "the specified value are considered for epilogue vectorization."));
 
+static cl::opt<bool> EpilogueVectorizationUseProfile(
+    "epilogue-vectorization-use-profile", cl::init(false), cl::Hidden,
+    cl::desc("When the trip count is not known at compile time, use the trip "
+             "count estimated from profile data to skip epilogue "
+             "vectorization factors that the estimated remaining iterations "
+             "would not fill."));
+
 /// Loops with a known constant trip count below this number are vectorized only
 /// if no scalar iteration overheads are incurred.
 static cl::opt<unsigned> TinyTripCountVectorThreshold(
@@ -5063,6 +5070,19 @@ VectorizationFactor LoopVectorizationPlanner::selectEpilogueVectorizationFactor(
   ScalarEvolution &SE = *PSE.getSE();
   Type *TCType = Legal->getWidestInductionType();
   const SCEV *RemainingIterations = nullptr;
+
+  // Iterations left for the epilogue according to the profile, if the exact
+  // trip count is unknown.
+  std::optional<unsigned> EstimatedRemainingIterations;
+  if (EpilogueVectorizationUseProfile && !MainLoopVF.isScalable() &&
+      !SE.getSmallConstantTripCount(OrigLoop))
+    if (std::optional<unsigned> EstimatedTC =
+            getLoopEstimatedTripCount(OrigLoop)) {
+      EstimatedRemainingIterations =
+          *EstimatedTC % (MainLoopVF.getKnownMinValue() * IC);
+      LLVM_DEBUG(dbgs() << "LEV: Estimated remaining iterations from profile: "
+                        << *EstimatedRemainingIterations << "\n");
+    }
   for (auto &NextVF : ProfitableVFs) {
     // Skip candidate VFs without a corresponding VPlan.
     if (!hasPlanWithVF(NextVF.Width))
@@ -5089,6 +5109,9 @@ VectorizationFactor LoopVectorizationPlanner::selectEpilogueVectorizationFactor(
               SE.getConstant(TCType, NextVF.Width.getKnownMinValue()),
               RemainingIterations))
         continue;
+      if (EstimatedRemainingIterations &&
+          NextVF.Width.getKnownMinValue() > *EstimatedRemainingIterations)
+        continue;
     }
 
     if (Result.Width.isScalar() || isMoreProfitable(NextVF, Result))
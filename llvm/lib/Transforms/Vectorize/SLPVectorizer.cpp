@@ -108,6 +108,11 @@ using namespace slpvectorizer;
 #define DEBUG_TYPE "SLP"
 
 STATISTIC(NumVectorInstructions, "Number of vector instructions generated");
+STATISTIC(NumTreesBuilt, "Number of SLP trees built");
+STATISTIC(NumTreesVectorized, "Number of SLP trees vectorized");
+STATISTIC(NumTreesSkippedBudget,
+          "Number of SLP trees not built because the per-function budget was "
+          "exhausted");
 
 static cl::opt<bool>
     RunSLPVectorization("vectorize-slp", cl::init(true), cl::Hidden,
@@ -155,6 +160,14 @@ static cl::opt<int>
 ScheduleRegionSizeBudget("slp-schedule-budget", cl::init(100000), cl::Hidden,
     cl::desc("Limit the size of the SLP scheduling region per block"));
 
+/// Limits the number of trees built per function. Each tree build walks the
+/// operands of its seeds and extends the scheduling regions, so machine
+/// generated straight-line code with many seeds can become quadratic.
+static cl::opt<unsigned> MaxTreesPerFunction(
+    "slp-max-trees-per-function", cl::init(0), cl::Hidden,
+    cl::desc("Maximum number of SLP trees to build per function "
+             "(0=unlimited)"));
+
 static cl::opt<int> MinVectorRegSizeOption(
     "slp-min-reg-size", cl::init(128), cl::Hidden,
     cl::desc("Attempt to vectorize for this register size in bits"));
@@ -3828,6 +3841,21 @@ private:
   unsigned MaxVecRegSize; // This is set by TTI or overridden by cl::opt.
   unsigned MinVecRegSize; // Set by cl::opt (default: 128).
 
+  /// Number of trees built so far in this function, checked against
+  /// MaxTreesPerFunction.
+  unsigned NumTreesInFunction = 0;
+
+  /// \returns true if another tree may be built in this function.
+  bool consumeTreeBudget() {
+    if (MaxTreesPerFunction && NumTreesInFunction >= MaxTreesPerFunction) {
+      ++NumTreesSkippedBudget;
+      return false;
+    }
+    ++NumTreesInFunction;
+    ++NumTreesBuilt;
+    return true;
+  }
+
   /// Instruction builder to construct the vectorized tree.
   IRBuilder<TargetFolder> Builder;
 
@@ -5881,14 +5909,14 @@ void BoUpSLP::buildTree(ArrayRef<Value *> Roots,
                         const SmallDenseSet<Value *> &UserIgnoreLst) {
   deleteTree();
   UserIgnoreList = &UserIgnoreLst;
-  if (!allSameType(Roots))
+  if (!allSameType(Roots) || !consumeTreeBudget())
     return;
   buildTree_rec(Roots, 0, EdgeInfo());
 }
 
 void BoUpSLP::buildTree(ArrayRef<Value *> Roots) {
   deleteTree();
-  if (!allSameType(Roots))
+  if (!allSameType(Roots) || !consumeTreeBudget())
     return;
   buildTree_rec(Roots, 0, EdgeInfo());
 }
@@ -13488,6 +13516,7 @@ Value *BoUpSLP::vectorizeTree(
     const ExtraValueToDebugLocsMap &ExternallyUsedValues,
     SmallVectorImpl<std::pair<Value *, Value *>> &ReplacedExternals,
     Instruction *ReductionRoot) {
+  ++NumTreesVectorized;
   // All blocks must be scheduled before any instructions are inserted.
   for (auto &BSIter : BlocksSchedules) {
     scheduleBlock(BSIter.second.get());
@@ -123,7 +123,7 @@ struct Benchmark {
   std::string Info;
   std::vector<uint8_t> AssembledSnippet;
   // How to aggregate measurements.
-  enum ResultAggregationModeE { Min, Max, Mean, MinVariance };
+  enum ResultAggregationModeE { Min, Max, Mean, MinVariance, Median };
 
   Benchmark() = default;
   Benchmark(Benchmark &&) = default;
@@ -61,6 +61,18 @@ static int64_t findMax(const SmallVector<int64_t, 4> &Values) {
   return *llvm::max_element(Values);
 }
 
+static int64_t findMedian(SmallVector<int64_t, 4> Values) {
+  if (Values.empty())
+    return 0;
+  auto Mid = Values.begin() + Values.size() / 2;
+  std::nth_element(Values.begin(), Mid, Values.end());
+  if (Values.size() % 2)
+    return *Mid;
+  // For an even count, average the two middle readings.
+  int64_t Lower = *std::max_element(Values.begin(), Mid);
+  return Lower + (*Mid - Lower) / 2;
+}
+
 static int64_t findMean(const SmallVector<int64_t, 4> &Values) {
   if (Values.empty())
     return 0;
@@ -159,6 +171,12 @@ Expected<std::vector<BenchmarkMeasure>> LatencyBenchmarkRunner::runMeasurements(
         ModeName, findMean(AccumulatedValues), ValidationInfo));
     return std::move(Result);
   }
+  case Benchmark::Median: {
+    std::vector<BenchmarkMeasure> Result;
+    Result.push_back(BenchmarkMeasure::Create(
+        ModeName, findMedian(AccumulatedValues), ValidationInfo));
+    return std::move(Result);
+  }
   }
   return make_error<Failure>(Twine("Unexpected benchmark mode(")
                                  .concat(std::to_string(Mode))
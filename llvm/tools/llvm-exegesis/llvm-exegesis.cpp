@@ -90,7 +90,10 @@ static cl::opt<Benchmark::ResultAggregationModeE> ResultAggMode(
                clEnumValN(Benchmark::Mean, "mean",
                           "Compute mean of all readings"),
                clEnumValN(Benchmark::MinVariance, "min-variance",
-                          "Keep readings set with min-variance")),
+                          "Keep readings set with min-variance"),
+               clEnumValN(Benchmark::Median, "median",
+                          "Compute median of all readings, which is robust "
+                          "against outliers")),
     cl::init(Benchmark::Min));
 
 static cl::opt<Benchmark::RepetitionModeE> RepetitionMode(
@@ -13,6 +13,9 @@
 
 #include "llvm-jitlink.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Format.h"
+
+#include <chrono>
 
 #define DEBUG_TYPE "llvm_jitlink"
 
@@ -32,6 +35,14 @@ static cl::opt<bool> ShowPostFixupTotalBlockSize(
              "graphs (post-fixup)"),
     cl::init(false));
 
+static cl::opt<bool> ShowGraphLinkTimes(
+    "graph-link-times",
+    cl::desc("Number of graphs linked and the total time spent linking them, "
+             "from the first pre-prune pass to the last post-fixup pass. "
+             "Graphs linked concurrently are counted separately, so the total "
+             "may exceed the wall-clock time"),
+    cl::init(false));
+
 class StatsPlugin : public ObjectLinkingLayer::Plugin {
 public:
   static void enableIfNeeded(Session &S, bool UsingOrcRuntime) {
@@ -48,6 +59,9 @@ public:
     if (ShowPostFixupTotalBlockSize)
       GetStats().PostFixupTotalBlockSize = 0;
 
+    if (ShowGraphLinkTimes)
+      GetStats().GraphLinkTimes.emplace();
+
     if (Instance)
       S.ObjLayer.addPlugin(std::move(Instance));
   }
@@ -62,6 +76,22 @@ public:
         [this](LinkGraph &G) { return recordPrePruneStats(G); });
     PassConfig.PostFixupPasses.push_back(
         [this](LinkGraph &G) { return recordPostFixupStats(G); });
+    if (GraphLinkTimes) {
+      auto Start = std::make_shared<std::chrono::steady_clock::time_point>();
+      auto RecordStart = [Start](LinkGraph &G) {
+        *Start = std::chrono::steady_clock::now();
+        return Error::success();
+      };
+      PassConfig.PrePrunePasses.insert(PassConfig.PrePrunePasses.begin(),
+                                       std::move(RecordStart));
+      PassConfig.PostFixupPasses.push_back([this, Start](LinkGraph &G) {
+        auto Elapsed = std::chrono::steady_clock::now() - *Start;
+        std::lock_guard<std::mutex> Lock(M);
+        ++GraphLinkTimes->NumGraphs;
+        GraphLinkTimes->TotalTime += Elapsed;
+        return Error::success();
+      });
+    }
   }
 
   Error notifyFailed(MaterializationResponsibility &MR) override {
@@ -85,6 +115,11 @@ private:
   std::mutex M;
   std::optional<uint64_t> PrePruneTotalBlockSize;
   std::optional<uint64_t> PostFixupTotalBlockSize;
+  struct LinkTimes {
+    uint64_t NumGraphs = 0;
+    std::chrono::steady_clock::duration TotalTime{};
+  };
+  std::optional<LinkTimes> GraphLinkTimes;
   std::optional<DenseMap<size_t, size_t>> EdgeCountDetails;
 };
 
@@ -102,6 +137,15 @@ void StatsPlugin::publish(raw_ostream &OS) {
   if (PostFixupTotalBlockSize)
     OS << "  Total size of all blocks after fixups: "
        << *PostFixupTotalBlockSize << "\n";
+
+  if (GraphLinkTimes) {
+    OS << "  Number of graphs linked: " << GraphLinkTimes->NumGraphs << "\n";
+    OS << "  Total time linking graphs: "
+       << format("%.3f",
+                 std::chrono::duration<double>(GraphLinkTimes->TotalTime)
+                     .count())
+       << "s\n";
+  }
 }
 
 static uint64_t computeTotalBlockSizes(LinkGraph &G) {
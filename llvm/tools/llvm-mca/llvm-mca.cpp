@@ -230,6 +230,12 @@ static cl::opt<bool>
                            cl::desc("Print instruction tables"),
                            cl::cat(ToolOptions), cl::init(false));
 
+static cl::opt<bool> PrintThroughputOnly(
+    "throughput-only",
+    cl::desc("Only print the block reciprocal throughput computed from the "
+             "scheduling model, without simulating the pipeline"),
+    cl::cat(ToolOptions), cl::init(false));
+
 static cl::opt<bool> PrintInstructionInfoView(
     "instruction-info",
     cl::desc("Print the instruction info view (enabled by default)"),
@@ -336,6 +342,37 @@ static void processViewOptions(bool IsOutOfOrder) {
     processOptionImpl(PrintRetireStats, Default);
 }
 
+/// Compute the reciprocal throughput of one iteration of \p Insts from the
+/// micro opcodes and resource cycles of each instruction, the same way the
+/// summary view reports it, but without simulating the pipeline.
+static double
+computeStaticRThroughput(const MCSchedModel &SM, unsigned DispatchWidth,
+                         ArrayRef<std::unique_ptr<mca::Instruction>> Insts) {
+  SmallVector<uint64_t> ProcResourceMasks(SM.getNumProcResourceKinds());
+  mca::computeProcResourceMasks(SM, ProcResourceMasks);
+  SmallVector<unsigned> ResIdx2ProcResID(SM.getNumProcResourceKinds(), 0);
+  for (unsigned I = 1, E = SM.getNumProcResourceKinds(); I < E; ++I)
+    ResIdx2ProcResID[mca::getResourceStateIndex(ProcResourceMasks[I])] = I;
+
+  unsigned NumMicroOps = 0;
+  SmallVector<unsigned> ProcResourceUsage(SM.getNumProcResourceKinds(), 0);
+  for (const std::unique_ptr<mca::Instruction> &Inst : Insts) {
+    const mca::InstrDesc &Desc = Inst->getDesc();
+    NumMicroOps += Desc.NumMicroOps;
+    for (const std::pair<uint64_t, mca::ResourceUsage> &RU : Desc.Resources) {
+      if (RU.second.size()) {
+        unsigned ProcResID =
+            ResIdx2ProcResID[mca::getResourceStateIndex(RU.first)];
+        ProcResourceUsage[ProcResID] += RU.second.size();
+      }
+    }
+  }
+
+  return mca::computeBlockRThroughput(
+      SM, DispatchWidth ? DispatchWidth : SM.IssueWidth, NumMicroOps,
+      ProcResourceUsage);
+}
+
 // Returns true on success.
 static bool runPipeline(mca::Pipeline &P) {
   // Handle pipeline errors here.
@@ -661,6 +698,31 @@ int main(int argc, char **argv) {
       continue;
     NonEmptyRegions++;
 
+    if (PrintThroughputOnly) {
+      double RThroughput =
+          computeStaticRThroughput(SM, DispatchWidth, LoweredSequence);
+
+      // The printer is only used for the region header and the JSON layout;
+      // nothing is run through the empty pipeline.
+      mca::Pipeline P;
+      mca::PipelinePrinter Printer(P, *Region, RegionIdx, *STI, PO);
+      if (PrintJson) {
+        Printer.printReport(JSONOutput);
+        JSONOutput.getArray("CodeRegions")
+            ->back()
+            .getAsObject()
+            ->try_emplace("BlockRThroughput", RThroughput);
+      } else {
+        Printer.printReport(TOF->os());
+        TOF->os() << "Block RThroughput: "
+                  << format("%.1f", floor((RThroughput * 10) + 0.5) / 10)
+                  << '\n';
+      }
+
+      ++RegionIdx;
+      continue;
+    }
+
     mca::CircularSourceMgr S(LoweredSequence,
                              PrintInstructionTables ? 1 : Iterations);
 
@@ -1933,7 +1933,7 @@ disassembleObject(ObjectFile &Obj, const ObjectFile &DbgObj,
     uint64_t Size;
     uint64_t Index;
     bool PrintedSection = false;
-    std::vector<RelocationRef> Rels = RelocMap[Section];
+    const std::vector<RelocationRef> &Rels = RelocMap[Section];
     std::vector<RelocationRef>::const_iterator RelCur = Rels.begin();
     std::vector<RelocationRef>::const_iterator RelEnd = Rels.end();
 
@@ -310,4 +310,46 @@ TEST(ConcurrentHashTableTest, AddStringEntriesParallelWithResize) {
               std::string::npos);
 }
 
+TEST(ConcurrentHashTableTest, FindAndForEachParallelWithResize) {
+  PerThreadBumpPtrAllocator Allocator;
+  const size_t NumElements = 20000;
+  ConcurrentHashTableByPtr<std::string, String, PerThreadBumpPtrAllocator,
+                           ConcurrentHashTableInfoByPtr<
+                               std::string, String, PerThreadBumpPtrAllocator>>
+      HashTable(Allocator, 100);
+
+  // Insert even elements while looking up all of them, so that lookups run
+  // concurrently with bucket rehashing.
+  parallelFor(0, NumElements, [&](size_t I) {
+    std::string StringForElement = formatv("{0}", I);
+    if (I % 2 == 0) {
+      std::pair<String *, bool> Entry = HashTable.insert(StringForElement);
+      EXPECT_TRUE(Entry.second);
+      EXPECT_EQ(HashTable.find(StringForElement), Entry.first);
+    } else {
+      EXPECT_EQ(HashTable.find(StringForElement), nullptr);
+    }
+  });
+
+  parallelFor(0, NumElements, [&](size_t I) {
+    std::string StringForElement = formatv("{0}", I);
+    String *Entry = HashTable.find(StringForElement);
+    if (I % 2 == 0) {
+      ASSERT_NE(Entry, nullptr);
+      EXPECT_EQ(Entry->getKey(), StringForElement);
+    } else {
+      EXPECT_EQ(Entry, nullptr);
+    }
+  });
+
+  size_t NumVisited = 0;
+  HashTable.forEach([&](String &Entry) {
+    ++NumVisited;
+    unsigned Value;
+    ASSERT_FALSE(StringRef(Entry.getKey()).getAsInteger(10, Value));
+    EXPECT_EQ(Value % 2, 0U);
+  });
+  EXPECT_EQ(NumVisited, NumElements / 2);
+}
+
 } // namespace
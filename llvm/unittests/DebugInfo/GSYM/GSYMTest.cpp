@@ -1127,6 +1127,34 @@ TEST(GSYMTest, TestGsymCreator8ByteAddrOffsets) {
                    ArrayRef<uint8_t>(UUID));
 }
 
+TEST(GSYMTest, TestGsymCreatorManyFunctions) {
+  // Encode more function infos than GsymCreator::encode() encodes per batch
+  // and make sure they all round trip in order.
+  GsymCreator GC;
+  constexpr uint64_t BaseAddr = 0x1000;
+  constexpr uint32_t NumFuncs = 10000;
+  const uint32_t FileIdx = GC.insertFile("/tmp/main.c");
+  for (uint32_t I = 0; I < NumFuncs; ++I) {
+    const uint64_t FuncAddr = BaseAddr + I * 0x20;
+    FunctionInfo FI(FuncAddr, 0x20,
+                    GC.insertString("func" + std::to_string(I)));
+    // Vary the encoded sizes so that the alignment padding varies too.
+    if (I % 3) {
+      FI.OptLineTable = LineTable();
+      for (uint32_t J = 0; J < I % 3; ++J)
+        FI.OptLineTable->push(LineEntry(FuncAddr + J * 4, FileIdx, I + J));
+    }
+    GC.addFunctionInfo(std::move(FI));
+  }
+  OutputAggregator Null(nullptr);
+  Error Err = GC.finalize(Null);
+  ASSERT_FALSE(Err);
+  TestEncodeDecode(GC, llvm::endianness::little, GSYM_VERSION, 4, BaseAddr,
+                   NumFuncs, ArrayRef<uint8_t>());
+  TestEncodeDecode(GC, llvm::endianness::big, GSYM_VERSION, 4, BaseAddr,
+                   NumFuncs, ArrayRef<uint8_t>());
+}
+
 static void VerifyFunctionInfo(const GsymReader &GR, uint64_t Addr,
                                const FunctionInfo &FI) {
   auto ExpFI = GR.getFunctionInfo(Addr);
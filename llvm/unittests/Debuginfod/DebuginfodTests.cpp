@@ -7,11 +7,16 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Debuginfod/Debuginfod.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/Debuginfod/HTTPClient.h"
+#include "llvm/Debuginfod/HTTPServer.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Testing/Support/Error.h"
 #include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
 
 #ifdef _WIN32
 #define setenv(name, var, ignore) _putenv_s(name, var)
@@ -67,3 +72,64 @@ TEST(DebuginfodClient, CacheMiss) {
   // A cache miss with no possible URLs should not create the cache directory.
   EXPECT_FALSE(sys::fs::exists(CacheDir));
 }
+
+#if defined(LLVM_ENABLE_HTTPLIB) && defined(LLVM_ENABLE_CURL)
+// Look up the same artifact from several threads at once while the server is
+// slow to answer, and return the number of requests the server received.
+static unsigned concurrentLookups(HTTPResponse Response, bool ExpectFound) {
+  std::atomic<unsigned> Requests{0};
+  HTTPServer Server;
+  EXPECT_THAT_ERROR(Server.get(R"(/(.*))",
+                               [&](HTTPServerRequest &Request) {
+                                 ++Requests;
+                                 std::this_thread::sleep_for(
+                                     std::chrono::milliseconds(200));
+                                 Request.setResponse(Response);
+                               }),
+                    Succeeded());
+  Expected<unsigned> PortOrErr = Server.bind();
+  EXPECT_THAT_EXPECTED(PortOrErr, Succeeded());
+  if (!PortOrErr)
+    return 0;
+  DefaultThreadPool ServerPool(hardware_concurrency(1));
+  ServerPool.async([&]() { EXPECT_THAT_ERROR(Server.listen(), Succeeded()); });
+  std::string Url = "http://localhost:" + utostr(*PortOrErr);
+  StringRef Urls[] = {Url};
+
+  SmallString<32> CacheDir;
+  EXPECT_FALSE(sys::fs::createUniqueDirectory("debuginfod-unittest", CacheDir));
+  HTTPClient::initialize();
+  constexpr unsigned NumThreads = 8;
+  std::vector<std::thread> Threads;
+  for (unsigned I = 0; I < NumThreads; ++I)
+    Threads.emplace_back([&]() {
+      Expected<std::string> PathOrErr = getCachedOrDownloadArtifact(
+          "concurrent-key", "/buildid/abcd/debuginfo", CacheDir, Urls,
+          std::chrono::milliseconds(10000));
+      if (ExpectFound)
+        EXPECT_THAT_EXPECTED(PathOrErr, Succeeded());
+      else
+        EXPECT_THAT_EXPECTED(PathOrErr, Failed<StringError>());
+    });
+  for (std::thread &T : Threads)
+    T.join();
+  Server.stop();
+  HTTPClient::cleanup();
+  sys::fs::remove_directories(CacheDir);
+  return Requests;
+}
+
+// Check that concurrent lookups of an artifact share a single download.
+TEST(DebuginfodClient, ConcurrentLookupsShareDownload) {
+  EXPECT_EQ(concurrentLookups({200u, "text/plain", "contents\n"},
+                              /*ExpectFound=*/true),
+            1u);
+}
+
+// Check that concurrent lookups of a missing artifact share the failure
+// instead of each querying the servers again.
+TEST(DebuginfodClient, ConcurrentLookupsShareFailure) {
+  EXPECT_EQ(concurrentLookups({404u, "text/plain", ""}, /*ExpectFound=*/false),
+            1u);
+}
+#endif
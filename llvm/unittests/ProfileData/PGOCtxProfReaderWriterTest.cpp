@@ -13,6 +13,7 @@
 #include "llvm/Support/Error.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Testing/Support/Error.h"
 #include "llvm/Testing/Support/SupportHelpers.h"
 #include "gtest/gtest.h"
 
@@ -253,3 +254,96 @@ TEST_F(PGOCtxProfRWTest, DuplicateTargets) {
     consumeError(Expected.takeError());
   }
 }
+
+static void checkScaled(const ContextNode &Raw,
+                        const PGOContextualProfile &Profile, uint64_t Scale) {
+  EXPECT_EQ(Raw.guid(), Profile.guid());
+  ASSERT_EQ(Raw.counters_size(), Profile.counters().size());
+  for (auto I = 0U; I < Raw.counters_size(); ++I)
+    EXPECT_EQ(Raw.counters()[I] * Scale, Profile.counters()[I]);
+  for (auto I = 0U; I < Raw.callsites_size(); ++I)
+    for (const auto *N = Raw.subContexts()[I]; N; N = N->next()) {
+      ASSERT_TRUE(Profile.hasCallsite(I));
+      auto It = Profile.callsite(I).find(N->guid());
+      ASSERT_NE(It, Profile.callsite(I).end());
+      checkScaled(*N, It->second, Scale);
+    }
+}
+
+TEST_F(PGOCtxProfRWTest, Merge) {
+  llvm::unittest::TempFile ProfileFile("ctx_profile", "", "", /*Unique*/ true);
+  {
+    std::error_code EC;
+    raw_fd_stream Out(ProfileFile.path(), EC);
+    ASSERT_FALSE(EC);
+    {
+      PGOCtxProfileWriter Writer(Out);
+      for (auto &[_, R] : roots())
+        Writer.write(*R);
+    }
+  }
+  auto MB = MemoryBuffer::getFile(ProfileFile.path());
+  ASSERT_TRUE(!!MB);
+  ASSERT_NE(*MB, nullptr);
+  auto Load = [&]() {
+    BitstreamCursor Cursor((*MB)->getBuffer());
+    PGOCtxProfileReader Reader(Cursor);
+    return Reader.loadContexts();
+  };
+  auto First = Load();
+  ASSERT_TRUE(!!First);
+  auto Second = Load();
+  ASSERT_TRUE(!!Second);
+  for (auto &[G, Ctx] : *Second)
+    ASSERT_THAT_ERROR(First->find(G)->second.merge(std::move(Ctx)),
+                      Succeeded());
+  for (auto &[G, R] : roots())
+    checkScaled(*R, First->find(G)->second, 2);
+
+  // Contexts of different functions cannot be merged.
+  auto Third = Load();
+  ASSERT_TRUE(!!Third);
+  EXPECT_THAT_ERROR(
+      First->find(1)->second.merge(std::move(Third->find(3)->second)),
+      Failed());
+}
+
+TEST_F(PGOCtxProfRWTest, MergeMismatchLeavesContextUnchanged) {
+  // A copy of root 1 whose deepest callee, guid 5, has one counter fewer.
+  auto *Root = createNode(1, 2, 2);
+  Root->counters()[0] = 100;
+  auto *L1 = createNode(2, 1, 1);
+  L1->counters()[0] = 100;
+  Root->subContexts()[1] = L1;
+  L1->subContexts()[0] = createNode(5, 5, 3);
+
+  llvm::unittest::TempFile ProfileFile("ctx_profile", "", "", /*Unique*/ true);
+  llvm::unittest::TempFile OtherFile("ctx_profile", "", "", /*Unique*/ true);
+  auto Write = [](StringRef Path, const ContextNode &R) {
+    std::error_code EC;
+    raw_fd_stream Out(Path, EC);
+    ASSERT_FALSE(EC);
+    PGOCtxProfileWriter Writer(Out);
+    Writer.write(R);
+  };
+  Write(ProfileFile.path(), *roots().at(1));
+  Write(OtherFile.path(), *Root);
+
+  auto MB = MemoryBuffer::getFile(ProfileFile.path());
+  ASSERT_TRUE(!!MB);
+  auto OtherMB = MemoryBuffer::getFile(OtherFile.path());
+  ASSERT_TRUE(!!OtherMB);
+  BitstreamCursor Cursor((*MB)->getBuffer());
+  PGOCtxProfileReader Reader(Cursor);
+  auto Profile = Reader.loadContexts();
+  ASSERT_TRUE(!!Profile);
+  BitstreamCursor OtherCursor((*OtherMB)->getBuffer());
+  PGOCtxProfileReader OtherReader(OtherCursor);
+  auto Other = OtherReader.loadContexts();
+  ASSERT_TRUE(!!Other);
+
+  EXPECT_THAT_ERROR(
+      Profile->find(1)->second.merge(std::move(Other->find(1)->second)),
+      Failed());
+  checkSame(*roots().at(1), Profile->find(1)->second);
+}
@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/Allocator.h"
+#include "llvm/Support/HugePageAllocator.h"
 #include "gtest/gtest.h"
 #include <cstdlib>
 
@@ -208,6 +209,34 @@ TEST(AllocatorTest, TestSlowerSlabGrowthDelay) {
   EXPECT_EQ(SlabSize * GrowthDelay + SlabSize * 2, Alloc.getTotalMemory());
 }
 
+TEST(AllocatorTest, TestHugePageSlabs) {
+  HugePageAllocator Slabs;
+  {
+    BumpPtrAllocatorImpl<HugePageAllocator &, HugePageAllocator::HugePageSize,
+                         HugePageAllocator::HugePageSize>
+        Alloc(Slabs);
+    char *Small = (char *)Alloc.Allocate(16, 8);
+    Small[0] = 1;
+    EXPECT_EQ(1U, Slabs.getNumBlocks());
+    EXPECT_EQ(HugePageAllocator::HugePageSize, Slabs.getBytesMapped());
+
+    // Allocations above the slab size get a mapping of their own. Leave room
+    // for the alignment padding so that it is exactly BigSize bytes.
+    size_t BigSize = 3 * HugePageAllocator::HugePageSize;
+    char *Big = (char *)Alloc.Allocate(BigSize - 16, 8);
+    Big[0] = Big[BigSize - 17] = 2;
+    EXPECT_EQ(2U, Slabs.getNumBlocks());
+    EXPECT_EQ(HugePageAllocator::HugePageSize + BigSize,
+              Slabs.getBytesMapped());
+
+    Alloc.Reset();
+    EXPECT_EQ(1U, Slabs.getNumBlocks());
+  }
+  EXPECT_EQ(0U, Slabs.getNumBlocks());
+  EXPECT_EQ(0U, Slabs.getBytesMapped());
+  EXPECT_EQ(4 * HugePageAllocator::HugePageSize, Slabs.getPeakBytesMapped());
+}
+
 // Mock slab allocator that returns slabs aligned on 4096 bytes.  There is no
 // easy portable way to do this, so this is kind of a hack.
 class MockSlabAllocator {
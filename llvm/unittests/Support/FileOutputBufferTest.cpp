@@ -158,4 +158,122 @@ TEST(FileOutputBuffer, Test) {
   // Clean up.
   ASSERT_NO_ERROR(fs::remove(TestDirectory.str()));
 }
+
+TEST(FileOutputBuffer, UpdateInPlace) {
+  SmallString<128> TestDirectory;
+  ASSERT_NO_ERROR(
+      fs::createUniqueDirectory("FileOutputBuffer-update", TestDirectory));
+  SmallString<128> File(TestDirectory);
+  File.append("/file");
+
+  // Create the initial file.
+  {
+    Expected<std::unique_ptr<FileOutputBuffer>> BufferOrErr =
+        FileOutputBuffer::create(File, 16384);
+    ASSERT_NO_ERROR(errorToErrorCode(BufferOrErr.takeError()));
+    std::unique_ptr<FileOutputBuffer> &Buffer = *BufferOrErr;
+    memset(Buffer->getBufferStart(), 'a', Buffer->getBufferSize());
+    ASSERT_NO_ERROR(errorToErrorCode(Buffer->commit()));
+  }
+  fs::UniqueID IDBefore;
+  ASSERT_NO_ERROR(fs::getUniqueID(File, IDBefore));
+
+  // Update it in place; only the tail changes.
+  {
+    Expected<std::unique_ptr<FileOutputBuffer>> BufferOrErr =
+        FileOutputBuffer::create(File, 16384,
+                                 FileOutputBuffer::F_update_in_place);
+    ASSERT_NO_ERROR(errorToErrorCode(BufferOrErr.takeError()));
+    std::unique_ptr<FileOutputBuffer> &Buffer = *BufferOrErr;
+    memset(Buffer->getBufferStart(), 'a', Buffer->getBufferSize());
+    memcpy(Buffer->getBufferEnd() - 4, "BBBB", 4);
+    ASSERT_NO_ERROR(errorToErrorCode(Buffer->commit()));
+  }
+
+  // The file has the new contents. Where it can be checked that nobody else
+  // uses the file, it also keeps its identity.
+  fs::UniqueID IDAfter;
+  ASSERT_NO_ERROR(fs::getUniqueID(File, IDAfter));
+#if defined(__linux__)
+  EXPECT_EQ(IDBefore, IDAfter);
+#endif
+  ErrorOr<std::unique_ptr<MemoryBuffer>> MB = MemoryBuffer::getFile(File);
+  ASSERT_NO_ERROR(MB.getError());
+  EXPECT_EQ((*MB)->getBufferSize(), 16384U);
+  EXPECT_EQ((*MB)->getBuffer().take_front(4), "aaaa");
+  EXPECT_EQ((*MB)->getBuffer().take_back(4), "BBBB");
+  MB->reset();
+
+  // A size mismatch falls back to replacing the file.
+  {
+    Expected<std::unique_ptr<FileOutputBuffer>> BufferOrErr =
+        FileOutputBuffer::create(File, 8192,
+                                 FileOutputBuffer::F_update_in_place);
+    ASSERT_NO_ERROR(errorToErrorCode(BufferOrErr.takeError()));
+    ASSERT_NO_ERROR(errorToErrorCode((*BufferOrErr)->commit()));
+  }
+  uint64_t FileSize;
+  ASSERT_NO_ERROR(fs::file_size(Twine(File), FileSize));
+  EXPECT_EQ(FileSize, 8192ULL);
+
+  ASSERT_NO_ERROR(fs::remove(File.str()));
+  ASSERT_NO_ERROR(fs::remove(TestDirectory.str()));
+}
+
+TEST(FileOutputBuffer, UpdateInPlaceFallback) {
+  SmallString<128> TestDirectory;
+  ASSERT_NO_ERROR(
+      fs::createUniqueDirectory("FileOutputBuffer-fallback", TestDirectory));
+  SmallString<128> File(TestDirectory);
+  File.append("/file");
+  SmallString<128> Link(TestDirectory);
+  Link.append("/link");
+
+  auto WriteFile = [&](char C, unsigned Flags) {
+    Expected<std::unique_ptr<FileOutputBuffer>> BufferOrErr =
+        FileOutputBuffer::create(File, 32768, Flags);
+    ASSERT_NO_ERROR(errorToErrorCode(BufferOrErr.takeError()));
+    std::unique_ptr<FileOutputBuffer> &Buffer = *BufferOrErr;
+    memset(Buffer->getBufferStart(), C, Buffer->getBufferSize());
+    ASSERT_NO_ERROR(errorToErrorCode(Buffer->commit()));
+  };
+  auto FirstChar = [](StringRef Path) {
+    ErrorOr<std::unique_ptr<MemoryBuffer>> MB = MemoryBuffer::getFile(Path);
+    EXPECT_TRUE(!!MB);
+    return MB ? (*MB)->getBuffer().front() : '\0';
+  };
+
+  // A file with another hard link is replaced, so the link keeps the old
+  // contents.
+  WriteFile('a', 0);
+  ASSERT_NO_ERROR(fs::create_hard_link(File, Link));
+  WriteFile('b', FileOutputBuffer::F_update_in_place);
+  EXPECT_EQ(FirstChar(File), 'b');
+  EXPECT_EQ(FirstChar(Link), 'a');
+  ASSERT_NO_ERROR(fs::remove(Link.str()));
+
+  // A file mapped by someone else is replaced, so the mapping keeps the old
+  // contents. The file is large enough for MemoryBuffer to map it.
+  {
+    ErrorOr<std::unique_ptr<MemoryBuffer>> Mapped = MemoryBuffer::getFile(
+        File, /*IsText=*/false, /*RequiresNullTerminator=*/false,
+        /*IsVolatile=*/false);
+    ASSERT_NO_ERROR(Mapped.getError());
+    WriteFile('c', FileOutputBuffer::F_update_in_place);
+    EXPECT_EQ((*Mapped)->getBuffer().front(), 'b');
+  }
+  EXPECT_EQ(FirstChar(File), 'c');
+
+  // The permissions of a newly created file are applied in either case.
+  WriteFile('d', FileOutputBuffer::F_update_in_place |
+                     FileOutputBuffer::F_executable);
+  ErrorOr<fs::perms> Perms = fs::getPermissions(File);
+  ASSERT_NO_ERROR(Perms.getError());
+#if !defined(_WIN32)
+  EXPECT_TRUE(*Perms & fs::owner_exe);
+#endif
+
+  ASSERT_NO_ERROR(fs::remove(File.str()));
+  ASSERT_NO_ERROR(fs::remove(TestDirectory.str()));
+}
 } // anonymous namespace
@@ -0,0 +1,100 @@
+//===- unittests/Support/JobserverTest.cpp - Jobserver client tests -------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/Jobserver.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/Testing/Support/SupportHelpers.h"
+#include "gtest/gtest.h"
+
+#ifdef LLVM_ON_UNIX
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace llvm;
+
+namespace {
+
+TEST(JobserverTest, ParseMakeFlags) {
+  EXPECT_EQ(parseJobserverMakeFlags("").Mode, JobserverConfig::None);
+  EXPECT_EQ(parseJobserverMakeFlags("-j8 -k").Mode, JobserverConfig::None);
+
+  JobserverConfig Pipe = parseJobserverMakeFlags(" -j8 --jobserver-auth=3,4");
+  EXPECT_EQ(Pipe.Mode, JobserverConfig::Pipe);
+  EXPECT_EQ(Pipe.ReadFD, 3);
+  EXPECT_EQ(Pipe.WriteFD, 4);
+
+  JobserverConfig Old = parseJobserverMakeFlags("--jobserver-fds=5,6 -j");
+  EXPECT_EQ(Old.Mode, JobserverConfig::Pipe);
+  EXPECT_EQ(Old.ReadFD, 5);
+  EXPECT_EQ(Old.WriteFD, 6);
+
+  JobserverConfig Fifo =
+      parseJobserverMakeFlags("-j4 --jobserver-auth=fifo:/tmp/GMfifo123");
+  EXPECT_EQ(Fifo.Mode, JobserverConfig::Fifo);
+  EXPECT_EQ(Fifo.Path, "/tmp/GMfifo123");
+
+  // The last option wins, and make marks an unusable jobserver with negative
+  // descriptors.
+  EXPECT_EQ(
+      parseJobserverMakeFlags("--jobserver-auth=3,4 --jobserver-auth=-2,-2")
+          .Mode,
+      JobserverConfig::None);
+  EXPECT_EQ(parseJobserverMakeFlags("--jobserver-auth=fifo:").Mode,
+            JobserverConfig::None);
+  EXPECT_EQ(parseJobserverMakeFlags("--jobserver-auth=3").Mode,
+            JobserverConfig::None);
+}
+
+TEST(JobserverTest, Invalid) {
+  JobserverConfig Config;
+  Config.Mode = JobserverConfig::Fifo;
+  Config.Path = "/nonexistent/jobserver/fifo";
+  JobserverClient Client(Config);
+  EXPECT_FALSE(Client.isValid());
+  EXPECT_EQ(Client.reserveSlots(8), 1U);
+}
+
+#ifdef LLVM_ON_UNIX
+TEST(JobserverTest, FifoTokens) {
+  unittest::TempDir Dir("jobserver-test", /*Unique=*/true);
+  SmallString<128> Path(Dir.path("fifo"));
+  ASSERT_EQ(::mkfifo(Path.c_str(), 0600), 0);
+
+  // Play the part of make: keep the fifo open and hand out three tokens.
+  int ServerFD = ::open(Path.c_str(), O_RDWR | O_NONBLOCK);
+  ASSERT_GE(ServerFD, 0);
+  ASSERT_EQ(::write(ServerFD, "abc", 3), 3);
+
+  JobserverConfig Config;
+  Config.Mode = JobserverConfig::Fifo;
+  Config.Path = std::string(Path);
+  {
+    JobserverClient Client(Config);
+    ASSERT_TRUE(Client.isValid());
+    // One implicit slot plus at most MaxSlots - 1 tokens.
+    EXPECT_EQ(Client.reserveSlots(3), 3U);
+    // Later calls never acquire more, but are still capped by MaxSlots.
+    EXPECT_EQ(Client.reserveSlots(8), 3U);
+    EXPECT_EQ(Client.reserveSlots(2), 2U);
+  }
+
+  // The client returned the tokens it took, and left the one it did not need.
+  char Buf[4];
+  ssize_t Read = ::read(ServerFD, Buf, sizeof(Buf));
+  ASSERT_EQ(Read, 3);
+  std::string Tokens(Buf, Read);
+  llvm::sort(Tokens);
+  EXPECT_EQ(Tokens, "abc");
+  ::close(ServerFD);
+}
+#endif
+
+} // end anonymous namespace
@@ -15,6 +15,7 @@
 #include "llvm/Support/ThreadPool.h"
 #include "gtest/gtest.h"
 #include <array>
+#include <atomic>
 #include <random>
 
 uint32_t array[1024 * 1024];
@@ -93,6 +94,28 @@ TEST(Parallel, ForEachError) {
   EXPECT_EQ(errText, std::string("asdf\nasdf\nasdf"));
 }
 
+TEST(Parallel, ForFirstError) {
+  std::atomic<unsigned> visited{0};
+  size_t errorIdx = 0;
+  Error e = parallelForFirstError(
+      0, 1000,
+      [&](size_t i) -> Error {
+        ++visited;
+        if (i % 100 == 37)
+          return createStringError(std::errc::invalid_argument,
+                                   "failed at %zu", i);
+        return Error::success();
+      },
+      &errorIdx);
+  EXPECT_EQ(visited, 1000U);
+  EXPECT_EQ(errorIdx, 37U);
+  EXPECT_EQ(toString(std::move(e)), "failed at 37");
+
+  EXPECT_FALSE(parallelForFirstError(
+      0, 10, [](size_t) { return Error::success(); }, &errorIdx));
+  EXPECT_EQ(errorIdx, 10U);
+}
+
 TEST(Parallel, TaskGroupSequentialFor) {
   size_t Count = 0;
   {
@@ -65,6 +65,61 @@ TEST(TimeProfiler, Async_Begin_End_Smoke) {
   ASSERT_TRUE(json.find(R"("detail":"detail")") != std::string::npos);
 }
 
+TEST(TimeProfiler, Summary_Smoke) {
+  timeTraceProfilerSetDetailSummary(true);
+  setupProfiler();
+  timeTraceProfilerSetDetailSummary(false);
+
+  {
+    TimeTraceScope outer("event", "detail");
+    TimeTraceScope inner("event", "detail");
+  }
+  { TimeTraceScope scope("event", "other"); }
+
+  SmallVector<char, 1024> smallVector;
+  raw_svector_ostream os(smallVector);
+  timeTraceProfilerWriteSummary(os);
+  timeTraceProfilerCleanup();
+  std::string json = os.str().str();
+  ASSERT_TRUE(json.find(R"({"name":"event","count":2,)") != std::string::npos);
+  ASSERT_TRUE(json.find(R"({"name":"event","detail":"detail","count":1,)") !=
+              std::string::npos);
+  ASSERT_TRUE(json.find(R"({"name":"event","detail":"other","count":1,)") !=
+              std::string::npos);
+}
+
+TEST(TimeProfiler, Summary_NoDetails) {
+  setupProfiler();
+
+  { TimeTraceScope scope("event", "detail"); }
+
+  SmallVector<char, 1024> smallVector;
+  raw_svector_ostream os(smallVector);
+  timeTraceProfilerWriteSummary(os);
+  timeTraceProfilerCleanup();
+  std::string json = os.str().str();
+  ASSERT_TRUE(json.find(R"({"name":"event","count":1,)") != std::string::npos);
+  ASSERT_TRUE(json.find(R"("details":[])") != std::string::npos);
+}
+
+TEST(TimeProfiler, Memory_Limit) {
+  timeTraceProfilerSetMemoryLimit(4096);
+  setupProfiler();
+  timeTraceProfilerSetMemoryLimit(0);
+
+  {
+    TimeTraceScope outer("outer");
+    for (int I = 0; I < 1000; ++I)
+      TimeTraceScope inner("inner");
+  }
+
+  std::string json = teardownProfiler();
+  ASSERT_TRUE(json.find(R"("name":"outer")") != std::string::npos);
+  ASSERT_TRUE(json.find(R"("droppedEvents":)") != std::string::npos);
+  // Totals still account for all events.
+  ASSERT_TRUE(json.find(R"("count":1000)") != std::string::npos);
+}
+
 TEST(TimeProfiler, Begin_End_Disabled) {
   // Nothing should be observable here. The test is really just making sure
   // we've not got a stray nullptr deref.
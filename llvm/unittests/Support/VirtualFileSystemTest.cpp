@@ -1044,6 +1044,49 @@ TEST(ProxyFileSystemTest, Basic) {
   EXPECT_FALSE(Local);
 }
 
+TEST(StatCachingFileSystemTest, Basic) {
+  IntrusiveRefCntPtr<vfs::InMemoryFileSystem> Base(
+      new vfs::InMemoryFileSystem());
+  ASSERT_FALSE(Base->setCurrentWorkingDirectory("/"));
+  IntrusiveRefCntPtr<vfs::StatCachingFileSystem> FS(
+      new vfs::StatCachingFileSystem(Base));
+
+  Base->addFile("/a", 0, MemoryBuffer::getMemBuffer("test"));
+
+  ErrorOr<vfs::Status> Stat = FS->status("/a");
+  ASSERT_FALSE(Stat.getError());
+  EXPECT_EQ(0U, FS->getNumHits());
+  EXPECT_EQ(1U, FS->getNumMisses());
+
+  // Relative and absolute spellings share the entry, but the status keeps
+  // the requested name.
+  Stat = FS->status("a");
+  ASSERT_FALSE(Stat.getError());
+  EXPECT_EQ("a", Stat->getName());
+  EXPECT_TRUE(FS->exists("/a"));
+  EXPECT_EQ(2U, FS->getNumHits());
+  EXPECT_EQ(1U, FS->getNumMisses());
+
+  // Failed lookups are cached as well, also for openFileForRead().
+  EXPECT_FALSE(FS->exists("/b"));
+  Base->addFile("/b", 0, MemoryBuffer::getMemBuffer("test"));
+  EXPECT_FALSE(FS->exists("/b"));
+  EXPECT_EQ(errc::no_such_file_or_directory,
+            FS->openFileForRead("/b").getError());
+  EXPECT_EQ(4U, FS->getNumHits());
+  EXPECT_EQ(2U, FS->getNumMisses());
+
+  FS->invalidate("/b");
+  EXPECT_TRUE(FS->exists("/b"));
+  auto File = FS->openFileForRead("/b");
+  ASSERT_FALSE(File.getError());
+  EXPECT_EQ("test", (*(*File)->getBuffer("ignored"))->getBuffer());
+
+  FS->clear();
+  EXPECT_TRUE(FS->exists("/a"));
+  EXPECT_EQ(4U, FS->getNumMisses());
+}
+
 class InMemoryFileSystemTest : public ::testing::Test {
 protected:
   llvm::vfs::InMemoryFileSystem FS;
@@ -236,8 +236,11 @@ public:
   /// does not exist.
   template <typename StateT, typename PointT>
   const StateT *lookupState(PointT point) const {
-    auto it = analysisStates.find({ProgramPoint(point), TypeID::get<StateT>()});
-    if (it == analysisStates.end())
+    auto pointIt = analysisStates.find(ProgramPoint(point));
+    if (pointIt == analysisStates.end())
+      return nullptr;
+    auto it = pointIt->second.find(TypeID::get<StateT>());
+    if (it == pointIt->second.end())
       return nullptr;
     return static_cast<const StateT *>(it->second.get());
   }
@@ -245,12 +248,7 @@ public:
   /// Erase any analysis state associated with the given program point.
   template <typename PointT>
   void eraseState(PointT point) {
-    ProgramPoint pp(point);
-
-    for (auto it = analysisStates.begin(); it != analysisStates.end(); ++it) {
-      if (it->first.first == pp)
-        analysisStates.erase(it);
-    }
+    analysisStates.erase(ProgramPoint(point));
   }
 
   /// Get a uniqued program point instance. If one is not present, it is
@@ -296,8 +294,11 @@ private:
   StorageUniquer uniquer;
 
   /// A type-erased map of program points to associated analysis states for
-  /// first-class program points.
-  DenseMap<std::pair<ProgramPoint, TypeID>, std::unique_ptr<AnalysisState>>
+  /// first-class program points. States are grouped by program point so that
+  /// all states of a point can be erased without scanning the whole map. A
+  /// point rarely has more than a few states, so keep those inline.
+  DenseMap<ProgramPoint,
+           llvm::SmallDenseMap<TypeID, std::unique_ptr<AnalysisState>, 4>>
       analysisStates;
 
   /// Allow the base child analysis class to access the internals of the solver.
@@ -497,7 +498,7 @@ AnalysisT *DataFlowSolver::load(Args &&...args) {
 template <typename StateT, typename PointT>
 StateT *DataFlowSolver::getOrCreateState(PointT point) {
   std::unique_ptr<AnalysisState> &state =
-      analysisStates[{ProgramPoint(point), TypeID::get<StateT>()}];
+      analysisStates[ProgramPoint(point)][TypeID::get<StateT>()];
   if (!state) {
     state = std::unique_ptr<StateT>(new StateT(point));
 #if LLVM_ENABLE_ABI_BREAKING_CHECKS
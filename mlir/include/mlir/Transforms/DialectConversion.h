@@ -999,8 +999,22 @@ private:
     DynamicLegalityCallbackFn legalityFn;
   };
 
+  /// A non-owning view of the legalization information of an operation. This
+  /// avoids copying the legality callback on every legality query.
+  struct LegalizationInfoRef {
+    /// The legality action this operation was given.
+    LegalizationAction action;
+
+    /// If some legal instances of this operation may also be recursively legal.
+    bool isRecursivelyLegal;
+
+    /// The legality callback if this operation is dynamically legal, or
+    /// nullptr if there is none.
+    const DynamicLegalityCallbackFn *legalityFn;
+  };
+
   /// Get the legalization information for the given operation.
-  std::optional<LegalizationInfo> getOpInfo(OperationName op) const;
+  std::optional<LegalizationInfoRef> getOpInfo(OperationName op) const;
 
   /// A deterministic mapping of operation name and its respective legality
   /// information.
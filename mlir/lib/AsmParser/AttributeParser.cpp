@@ -364,9 +364,15 @@ Attribute Parser::parseFloatAttr(Type type, bool isNegative) {
 static std::optional<APInt> buildAttributeAPInt(Type type, bool isNegative,
                                                 StringRef spelling) {
   // Parse the integer value into an APInt that is big enough to hold the value.
+  // Most literals fit into 64 bits, which is much cheaper to parse than going
+  // through APInt directly, so try that first.
   APInt result;
   bool isHex = spelling.size() > 1 && spelling[1] == 'x';
-  if (spelling.getAsInteger(isHex ? 0 : 10, result))
+  unsigned radix = isHex ? 0 : 10;
+  uint64_t smallValue;
+  if (!spelling.getAsInteger(radix, smallValue))
+    result = APInt(64, smallValue);
+  else if (spelling.getAsInteger(radix, result))
     return std::nullopt;
 
   // Extend or truncate the bitwidth to the right size.
@@ -541,7 +541,7 @@ void IRNumberingState::number(Dialect *dialect,
   for (const auto &resource : resources) {
     // Check if this is a newly seen resource.
     if (!dialectNumber.resources.insert(resource))
-      return;
+      continue;
 
     auto *numbering =
         new (resourceAllocator.Allocate()) DialectResourceNumbering(
@@ -307,13 +307,19 @@ static void setTokenState(AsyncToken *token, State state) {
   assert(State(token->state).isUnavailable() && "token must be unavailable");
 
   // Make sure that `dropRef` does not destroy the mutex owned by the lock.
+  // Awaiters registered after the state change run immediately, so the
+  // pending ones can be run without holding the lock. They often resume
+  // coroutines inline, which must not block other threads awaiting or
+  // adding awaiters to this token.
+  std::vector<std::function<void()>> awaiters;
   {
     std::unique_lock<std::mutex> lock(token->mu);
     token->state = state;
     token->cv.notify_all();
-    for (auto &awaiter : token->awaiters)
-      awaiter();
+    awaiters.swap(token->awaiters);
   }
+  for (auto &awaiter : awaiters)
+    awaiter();
 
   // Async tokens created with a ref count `2` to keep token alive until the
   // async task completes. Drop this reference explicitly when token emplaced.
@@ -325,13 +331,19 @@ static void setValueState(AsyncValue *value, State state) {
   assert(State(value->state).isUnavailable() && "value must be unavailable");
 
   // Make sure that `dropRef` does not destroy the mutex owned by the lock.
+  // Awaiters registered after the state change run immediately, so the
+  // pending ones can be run without holding the lock. They often resume
+  // coroutines inline, which must not block other threads awaiting or
+  // adding awaiters to this value.
+  std::vector<std::function<void()>> awaiters;
   {
     std::unique_lock<std::mutex> lock(value->mu);
     value->state = state;
     value->cv.notify_all();
-    for (auto &awaiter : value->awaiters)
-      awaiter();
+    awaiters.swap(value->awaiters);
   }
+  for (auto &awaiter : awaiters)
+    awaiter();
 
   // Async values created with a ref count `2` to keep value alive until the
   // async task completes. Drop this reference explicitly when value emplaced.
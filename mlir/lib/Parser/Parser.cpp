@@ -13,6 +13,8 @@
 #include "mlir/Parser/Parser.h"
 #include "mlir/AsmParser/AsmParser.h"
 #include "mlir/Bytecode/BytecodeReader.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/SourceMgr.h"
 
 using namespace mlir;
@@ -61,13 +63,35 @@ static LogicalResult loadSourceFileBuffer(llvm::StringRef filename,
     return emitError(mlir::UnknownLoc::get(ctx),
                      "only main buffer parsed at the moment");
   }
-  auto fileOrErr = llvm::MemoryBuffer::getFileOrSTDIN(filename);
+  // Bytecode does not need a null terminator, and requiring one keeps files
+  // whose size is a multiple of the page size from being mmapped. Resources
+  // in bytecode may reference the buffer directly, so reading the file into
+  // memory instead would keep a full copy of it alive. Stdin and pipes are
+  // read into memory anyway and can only be read once, so request the null
+  // terminator for them up front.
+  bool isRegularFile =
+      filename != "-" && llvm::sys::fs::is_regular_file(filename);
+  auto fileOrErr = llvm::MemoryBuffer::getFileOrSTDIN(
+      filename, /*IsText=*/false,
+      /*RequiresNullTerminator=*/!isRegularFile);
   if (fileOrErr.getError())
     return emitError(mlir::UnknownLoc::get(ctx),
                      "could not open input file " + filename);
+  std::unique_ptr<llvm::MemoryBuffer> buffer = std::move(*fileOrErr);
+
+  // The textual parser relies on the null terminator, so reopen regular text
+  // files with one.
+  if (isRegularFile && !isBytecode(*buffer)) {
+    fileOrErr = llvm::MemoryBuffer::getFile(filename, /*IsText=*/false,
+                                            /*RequiresNullTerminator=*/true);
+    if (fileOrErr.getError())
+      return emitError(mlir::UnknownLoc::get(ctx),
+                       "could not open input file " + filename);
+    buffer = std::move(*fileOrErr);
+  }
 
   // Load the MLIR source file.
-  sourceMgr.AddNewSourceBuffer(std::move(*fileOrErr), SMLoc());
+  sourceMgr.AddNewSourceBuffer(std::move(buffer), SMLoc());
   return success();
 }
 
@@ -3248,21 +3248,21 @@ void ConversionTarget::setDialectAction(ArrayRef<StringRef> dialectNames,
 
 auto ConversionTarget::getOpAction(OperationName op) const
     -> std::optional<LegalizationAction> {
-  std::optional<LegalizationInfo> info = getOpInfo(op);
+  std::optional<LegalizationInfoRef> info = getOpInfo(op);
   return info ? info->action : std::optional<LegalizationAction>();
 }
 
 auto ConversionTarget::isLegal(Operation *op) const
     -> std::optional<LegalOpDetails> {
-  std::optional<LegalizationInfo> info = getOpInfo(op->getName());
+  std::optional<LegalizationInfoRef> info = getOpInfo(op->getName());
   if (!info)
     return std::nullopt;
 
   // Returns true if this operation instance is known to be legal.
   auto isOpLegal = [&] {
     // Handle dynamic legality either with the provided legality function.
-    if (info->action == LegalizationAction::Dynamic) {
-      std::optional<bool> result = info->legalityFn(op);
+    if (info->action == LegalizationAction::Dynamic && info->legalityFn) {
+      std::optional<bool> result = (*info->legalityFn)(op);
       if (result)
         return *result;
     }
@@ -3288,12 +3288,14 @@ auto ConversionTarget::isLegal(Operation *op) const
 }
 
 bool ConversionTarget::isIllegal(Operation *op) const {
-  std::optional<LegalizationInfo> info = getOpInfo(op->getName());
+  std::optional<LegalizationInfoRef> info = getOpInfo(op->getName());
   if (!info)
     return false;
 
   if (info->action == LegalizationAction::Dynamic) {
-    std::optional<bool> result = info->legalityFn(op);
+    if (!info->legalityFn)
+      return false;
+    std::optional<bool> result = (*info->legalityFn)(op);
     if (!result)
       return false;
 
@@ -3359,25 +3361,30 @@ void ConversionTarget::setLegalityCallback(
 }
 
 auto ConversionTarget::getOpInfo(OperationName op) const
-    -> std::optional<LegalizationInfo> {
+    -> std::optional<LegalizationInfoRef> {
   // Check for info for this specific operation.
   const auto *it = legalOperations.find(op);
-  if (it != legalOperations.end())
-    return it->second;
+  if (it != legalOperations.end()) {
+    const DynamicLegalityCallbackFn &callback = it->second.legalityFn;
+    return LegalizationInfoRef{it->second.action, it->second.isRecursivelyLegal,
+                               callback ? &callback : nullptr};
+  }
   // Check for info for the parent dialect.
-  auto dialectIt = legalDialects.find(op.getDialectNamespace());
+  StringRef dialectNamespace = op.getDialectNamespace();
+  auto dialectIt = legalDialects.find(dialectNamespace);
   if (dialectIt != legalDialects.end()) {
-    DynamicLegalityCallbackFn callback;
-    auto dialectFn = dialectLegalityFns.find(op.getDialectNamespace());
+    const DynamicLegalityCallbackFn *callback = nullptr;
+    auto dialectFn = dialectLegalityFns.find(dialectNamespace);
     if (dialectFn != dialectLegalityFns.end())
-      callback = dialectFn->second;
-    return LegalizationInfo{dialectIt->second, /*isRecursivelyLegal=*/false,
-                            callback};
+      callback = &dialectFn->second;
+    return LegalizationInfoRef{dialectIt->second, /*isRecursivelyLegal=*/false,
+                               callback};
   }
   // Otherwise, check if we mark unknown operations as dynamic.
   if (unknownLegalityFn)
-    return LegalizationInfo{LegalizationAction::Dynamic,
-                            /*isRecursivelyLegal=*/false, unknownLegalityFn};
+    return LegalizationInfoRef{LegalizationAction::Dynamic,
+                               /*isRecursivelyLegal=*/false,
+                               &unknownLegalityFn};
   return std::nullopt;
 }
 
@@ -194,7 +194,9 @@ static void logSuccessfulFolding(Operation *op) {
 /// This class maintains a vector of operations and a mapping of operations to
 /// positions in the vector, so that operations can be removed efficiently at
 /// random. When an operation is removed, it is replaced with nullptr. Such
-/// nullptr are skipped when pop'ing elements.
+/// nullptr are skipped when pop'ing elements. The last element of the vector
+/// is never nullptr, so that checking for emptiness does not have to scan
+/// over removed operations.
 class Worklist {
 public:
   Worklist();
@@ -220,6 +222,9 @@ public:
   void reverse();
 
 protected:
+  /// Remove all trailing nullptr from `list`.
+  void trimTrailingNull();
+
   /// The worklist of operations.
   std::vector<Operation *> list;
 
@@ -234,10 +239,11 @@ void Worklist::clear() {
   map.clear();
 }
 
-bool Worklist::empty() const {
-  // Skip all nullptr.
-  return !llvm::any_of(list,
-                       [](Operation *op) { return static_cast<bool>(op); });
+bool Worklist::empty() const { return list.empty(); }
+
+void Worklist::trimTrailingNull() {
+  while (!list.empty() && !list.back())
+    list.pop_back();
 }
 
 void Worklist::push(Operation *op) {
@@ -250,15 +256,10 @@ void Worklist::push(Operation *op) {
 
 Operation *Worklist::pop() {
   assert(!empty() && "cannot pop from empty worklist");
-  // Skip and remove all trailing nullptr.
-  while (!list.back())
-    list.pop_back();
   Operation *op = list.back();
   list.pop_back();
   map.erase(op);
-  // Cleanup: Remove all trailing nullptr.
-  while (!list.empty() && !list.back())
-    list.pop_back();
+  trimTrailingNull();
   return op;
 }
 
@@ -269,13 +270,16 @@ void Worklist::remove(Operation *op) {
     assert(list[it->second] == op && "malformed worklist data structure");
     list[it->second] = nullptr;
     map.erase(it);
+    trimTrailingNull();
   }
 }
 
 void Worklist::reverse() {
   std::reverse(list.begin(), list.end());
+  trimTrailingNull();
   for (size_t i = 0, e = list.size(); i != e; ++i)
-    map[list[i]] = i;
+    if (list[i])
+      map[list[i]] = i;
 }
 
 #ifdef MLIR_GREEDY_REWRITE_RANDOMIZER_SEED
@@ -301,6 +305,7 @@ public:
         map[list[i]] = i;
       map.erase(op);
     } while (!op);
+    trimTrailingNull();
     return op;
   }
 
@@ -101,4 +101,34 @@ TEST(MLIRParser, ParseAttr) {
     EXPECT_EQ(attr, b.getI64IntegerAttr(9));
   }
 }
+
+TEST(MLIRParser, ParseIntegerLiterals) {
+  MLIRContext context;
+  Builder b(&context);
+  // Values that fit into 64 bits and those that do not must produce the same
+  // attributes, including at the boundaries of the element width.
+  EXPECT_EQ(parseAttribute("18446744073709551615 : ui64", &context),
+            b.getIntegerAttr(b.getIntegerType(64, /*isSigned=*/false),
+                             APInt::getMaxValue(64)));
+  EXPECT_EQ(parseAttribute("-9223372036854775808 : i64", &context),
+            b.getI64IntegerAttr(std::numeric_limits<int64_t>::min()));
+  EXPECT_EQ(parseAttribute("0xFFFFFFFFFFFFFFFF : i64", &context),
+            b.getI64IntegerAttr(-1));
+  StringLiteral denseAsm =
+      "dense<[1, -2, 340282366920938463463374607431768211455]> : "
+      "tensor<3xi128>";
+  SmallVector<APInt> denseValues = {APInt(128, 1),
+                                    APInt(128, -2, /*isSigned=*/true),
+                                    APInt::getMaxValue(128)};
+  EXPECT_EQ(parseAttribute(denseAsm, &context),
+            DenseElementsAttr::get(
+                RankedTensorType::get({3}, b.getIntegerType(128)),
+                denseValues));
+
+  // Out of range values are still rejected.
+  ScopedDiagnosticHandler handler(&context, [](Diagnostic &) {});
+  EXPECT_FALSE(parseAttribute("256 : i8", &context));
+  EXPECT_FALSE(parseAttribute("9223372036854775808 : si64", &context));
+  EXPECT_FALSE(parseAttribute("18446744073709551616 : ui64", &context));
+}
 } // namespace
@@ -70,6 +70,12 @@ private:
   getOrCreateObjFile(const __tgt_device_image &Image, LLVMContext &Ctx,
                      const std::string &ComputeUnitKind);
 
+  /// Return the path of the on-disk cache entry for the device image that
+  /// \p Image compiles to for \p ComputeUnitKind, or an empty string if the
+  /// cache is disabled.
+  std::string getCachePath(const __tgt_device_image &Image,
+                           const std::string &ComputeUnitKind);
+
   /// Run backend, which contains optimization and code generation.
   Expected<std::unique_ptr<MemoryBuffer>>
   backend(Module &M, const std::string &ComputeUnitKind, unsigned OptLevel);
@@ -112,6 +118,7 @@ private:
       StringEnvar("LIBOMPTARGET_JIT_POST_OPT_IR_MODULE");
   UInt32Envar JITOptLevel = UInt32Envar("LIBOMPTARGET_JIT_OPT_LEVEL", 3);
   BoolEnvar JITSkipOpt = BoolEnvar("LIBOMPTARGET_JIT_SKIP_OPT", false);
+  StringEnvar JITCacheDir = StringEnvar("LIBOMPTARGET_JIT_CACHE_DIR");
 };
 
 } // namespace target
@@ -16,9 +16,12 @@
 #include "PluginInterface.h"
 #include "omptarget.h"
 
+#include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/CodeGen/CommandFlags.h"
 #include "llvm/CodeGen/MachineModuleInfo.h"
+#include "llvm/Config/llvm-config.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/LLVMRemarkStreamer.h"
 #include "llvm/IR/LegacyPassManager.h"
@@ -28,11 +31,16 @@
 #include "llvm/Object/IRObjectFile.h"
 #include "llvm/Passes/OptimizationLevel.h"
 #include "llvm/Passes/PassBuilder.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/SHA1.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/ToolOutputFile.h"
+#include "llvm/Support/VCSRevision.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
@@ -276,6 +284,45 @@ JITEngine::getOrCreateObjFile(const __tgt_device_image &Image, LLVMContext &Ctx,
   return backend(*Mod, ComputeUnitKind, JITOptLevel);
 }
 
+std::string JITEngine::getCachePath(const __tgt_device_image &Image,
+                                    const std::string &ComputeUnitKind) {
+  // Replacements and IR dumps are debugging aids that must see a compilation.
+  if (!JITCacheDir.isPresent() || ReplacementObjectFileName.isPresent() ||
+      ReplacementModuleFileName.isPresent() ||
+      PreOptIRModuleFileName.isPresent() || PostOptIRModuleFileName.isPresent())
+    return "";
+
+  // The image only depends on the bitcode, the compiler, and the options.
+  // Hash them the way the LTO cache does, so that distinct inputs cannot end
+  // up sharing an entry.
+  SHA1 Hasher;
+  Hasher.update(LLVM_VERSION_STRING);
+#ifdef LLVM_REVISION
+  Hasher.update(LLVM_REVISION);
+#endif
+  auto AddString = [&](StringRef Str) {
+    Hasher.update(Str);
+    Hasher.update(ArrayRef<uint8_t>{0});
+  };
+  auto AddUnsigned = [&](unsigned I) {
+    uint8_t Data[4];
+    support::endian::write32le(Data, I);
+    Hasher.update(Data);
+  };
+  AddString(TT.str());
+  AddString(ComputeUnitKind);
+  AddUnsigned(JITOptLevel.get());
+  AddUnsigned(JITSkipOpt.get());
+  Hasher.update(
+      StringRef(reinterpret_cast<const char *>(Image.ImageStart),
+                target::getPtrDiff(Image.ImageEnd, Image.ImageStart)));
+
+  SmallString<128> Path(JITCacheDir.get());
+  sys::path::append(Path,
+                    ComputeUnitKind + "-" + toHex(Hasher.result()) + ".img");
+  return std::string(Path);
+}
+
 Expected<const __tgt_device_image *>
 JITEngine::compile(const __tgt_device_image &Image,
                    const std::string &ComputeUnitKind,
@@ -287,15 +334,43 @@ JITEngine::compile(const __tgt_device_image &Image,
   if (__tgt_device_image *JITedImage = CUI.TgtImageMap.lookup(&Image))
     return JITedImage;
 
-  auto ObjMBOrErr = getOrCreateObjFile(Image, CUI.Context, ComputeUnitKind);
-  if (!ObjMBOrErr)
-    return ObjMBOrErr.takeError();
+  // Then check if an earlier run left the image in the on-disk cache.
+  std::string CachePath = getCachePath(Image, ComputeUnitKind);
+  std::unique_ptr<MemoryBuffer> ImageMB;
+  if (!CachePath.empty()) {
+    if (auto MBOrErr = MemoryBuffer::getFile(CachePath)) {
+      DP("Using cached JIT image %s\n", CachePath.c_str());
+      ImageMB = std::move(*MBOrErr);
+    }
+  }
 
-  auto ImageMBOrErr = PostProcessing(std::move(*ObjMBOrErr));
-  if (!ImageMBOrErr)
-    return ImageMBOrErr.takeError();
+  if (!ImageMB) {
+    auto ObjMBOrErr = getOrCreateObjFile(Image, CUI.Context, ComputeUnitKind);
+    if (!ObjMBOrErr)
+      return ObjMBOrErr.takeError();
+
+    auto ImageMBOrErr = PostProcessing(std::move(*ObjMBOrErr));
+    if (!ImageMBOrErr)
+      return ImageMBOrErr.takeError();
+    ImageMB = std::move(*ImageMBOrErr);
+
+    // A failure to populate the cache only costs the next run a compilation.
+    // The entry is written to a temporary file first and then renamed, so
+    // concurrent processes never see a partial image.
+    if (!CachePath.empty()) {
+      sys::fs::create_directories(JITCacheDir.get());
+      if (Error Err = writeToOutput(CachePath, [&](raw_ostream &OS) {
+            OS << ImageMB->getBuffer();
+            return Error::success();
+          })) {
+        [[maybe_unused]] std::string ErrStr = toString(std::move(Err));
+        DP("Failed to write JIT image %s: %s\n", CachePath.c_str(),
+           ErrStr.c_str());
+      }
+    }
+  }
 
-  CUI.JITImages.push_back(std::move(*ImageMBOrErr));
+  CUI.JITImages.push_back(std::move(ImageMB));
   __tgt_device_image *&JITedImage = CUI.TgtImageMap[&Image];
   JITedImage = new __tgt_device_image();
   *JITedImage = Image;
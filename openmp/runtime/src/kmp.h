@@ -1312,6 +1312,8 @@ extern kmp_uint64 __kmp_now_nsec();
 
 #define KMP_MAX_TASK_PRIORITY_LIMIT INT_MAX
 
+#define KMP_MAX_TASK_STEAL_NEAR_TRIES 64
+
 /* Minimum number of threads before switch to TLS gtid (experimentally
    determined) */
 /* josh TODO: what about OS X* tuning? */
@@ -2439,6 +2441,8 @@ extern kmp_int32 __kmp_default_device; // Set via OMP_DEFAULT_DEVICE if
 extern kmp_int32 __kmp_max_task_priority;
 // Set via KMP_TASKLOOP_MIN_TASKS if specified, defaults to 0 otherwise
 extern kmp_uint64 __kmp_taskloop_min_tasks;
+// Set via KMP_TASK_STEAL_NEAR_TRIES if specified, defaults to 1 otherwise
+extern int __kmp_task_steal_near_tries;
 
 /* NOTE: kmp_taskdata_t and kmp_task_t structures allocated in single block with
    taskdata first */
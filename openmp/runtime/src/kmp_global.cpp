@@ -299,6 +299,7 @@ kmp_int32 __kmp_default_device = 0;
 kmp_tasking_mode_t __kmp_tasking_mode = tskm_task_teams;
 kmp_int32 __kmp_max_task_priority = 0;
 kmp_uint64 __kmp_taskloop_min_tasks = 0;
+int __kmp_task_steal_near_tries = 1;
 
 int __kmp_memkind_available = 0;
 omp_allocator_handle_t const omp_null_allocator = NULL;
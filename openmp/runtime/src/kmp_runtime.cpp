@@ -73,6 +73,10 @@ char const __kmp_version_lock[] =
 
 #define KMP_MIN(x, y) ((x) < (y) ? (x) : (y))
 
+/* Use the distributed barrier by default on machines with at least this many
+   processors. */
+#define KMP_DIST_BAR_MIN_XPROC 128
+
 /* ------------------------------------------------------------------------ */
 
 #if KMP_USE_MONITOR
@@ -7257,6 +7261,20 @@ static void __kmp_do_serial_initialize(void) {
   }
 #endif // KMP_FAST_REDUCTION_BARRIER
 #endif // KMP_MIC_SUPPORTED
+  // On wide machines the distributed barrier scales better than the hyper
+  // barrier. It must be used either for all barriers or for none of them;
+  // explicit barrier pattern settings are reconciled with this default in
+  // __kmp_stg_parse_barrier_pattern().
+  bool use_dist_bar = __kmp_xproc >= KMP_DIST_BAR_MIN_XPROC;
+#if KMP_MIC_SUPPORTED
+  use_dist_bar = use_dist_bar && __kmp_mic_type != mic2;
+#endif
+  if (use_dist_bar) {
+    for (i = bs_plain_barrier; i < bs_last_barrier; i++) {
+      __kmp_barrier_gather_pattern[i] = bp_dist_bar;
+      __kmp_barrier_release_pattern[i] = bp_dist_bar;
+    }
+  }
 
 // From KMP_CHECKS initialization
 #ifdef KMP_DEBUG
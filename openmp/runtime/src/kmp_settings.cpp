@@ -1484,6 +1484,21 @@ static void __kmp_stg_print_taskloop_min_tasks(kmp_str_buf_t *buffer,
   __kmp_stg_print_uint64(buffer, name, __kmp_taskloop_min_tasks);
 } // __kmp_stg_print_taskloop_min_tasks
 
+// KMP_TASK_STEAL_NEAR_TRIES
+// number of random draws spent looking for a steal victim close to the thief
+static void __kmp_stg_parse_task_steal_near_tries(char const *name,
+                                                  char const *value,
+                                                  void *data) {
+  __kmp_stg_parse_int(name, value, 1, KMP_MAX_TASK_STEAL_NEAR_TRIES,
+                      &__kmp_task_steal_near_tries);
+} // __kmp_stg_parse_task_steal_near_tries
+
+static void __kmp_stg_print_task_steal_near_tries(kmp_str_buf_t *buffer,
+                                                  char const *name,
+                                                  void *data) {
+  __kmp_stg_print_int(buffer, name, __kmp_task_steal_near_tries);
+} // __kmp_stg_print_task_steal_near_tries
+
 // -----------------------------------------------------------------------------
 // KMP_DISP_NUM_BUFFERS
 static void __kmp_stg_parse_disp_buffers(char const *name, char const *value,
@@ -1825,6 +1840,15 @@ static void __kmp_stg_parse_barrier_pattern(char const *name, char const *value,
       if (__kmp_barrier_gather_pattern[i] != bp_dist_bar)
         __kmp_barrier_gather_pattern[i] = bp_dist_bar;
     }
+  } else if (non_dist_req != 0) {
+    // dist was not requested, so it is only the default on wide machines; it
+    // cannot be mixed with the requested patterns
+    for (int i = bs_plain_barrier; i < bs_last_barrier; i++) {
+      if (__kmp_barrier_release_pattern[i] == bp_dist_bar)
+        __kmp_barrier_release_pattern[i] = __kmp_barrier_release_pat_dflt;
+      if (__kmp_barrier_gather_pattern[i] == bp_dist_bar)
+        __kmp_barrier_gather_pattern[i] = __kmp_barrier_gather_pat_dflt;
+    }
   }
 } // __kmp_stg_parse_barrier_pattern
 
@@ -5557,6 +5581,8 @@ static kmp_setting_t __kmp_stg_table[] = {
      __kmp_stg_print_max_task_priority, NULL, 0, 0},
     {"KMP_TASKLOOP_MIN_TASKS", __kmp_stg_parse_taskloop_min_tasks,
      __kmp_stg_print_taskloop_min_tasks, NULL, 0, 0},
+    {"KMP_TASK_STEAL_NEAR_TRIES", __kmp_stg_parse_task_steal_near_tries,
+     __kmp_stg_print_task_steal_near_tries, NULL, 0, 0},
     {"OMP_THREAD_LIMIT", __kmp_stg_parse_thread_limit,
      __kmp_stg_print_thread_limit, NULL, 0, 0},
     {"KMP_TEAMS_THREAD_LIMIT", __kmp_stg_parse_teams_thread_limit,
@@ -11,6 +11,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "kmp.h"
+#include "kmp_affinity.h"
 #include "kmp_i18n.h"
 #include "kmp_itt.h"
 #include "kmp_stats.h"
@@ -3225,6 +3226,51 @@ static kmp_task_t *__kmp_remove_my_task(kmp_info_t *thread, kmp_int32 gtid,
   return task;
 }
 
+#if KMP_AFFINITY_SUPPORTED
+// __kmp_is_near_victim: check whether the victim shares the innermost known
+// last-level cache, NUMA node or socket with the thief. Ids are negative when
+// unknown or when a thread's mask spans several units. Ids are only recorded
+// for the levels of the topology, so map each kind of unit to the level it
+// is equivalent to, if any.
+static bool __kmp_is_near_victim(kmp_info_t *thief, kmp_info_t *victim) {
+  static const kmp_hw_t levels[] = {KMP_HW_LLC, KMP_HW_NUMA, KMP_HW_SOCKET};
+  if (!__kmp_topology)
+    return true;
+  for (kmp_hw_t level : levels) {
+    kmp_hw_t type = __kmp_topology->get_equivalent_type(level);
+    if (type == KMP_HW_UNKNOWN)
+      continue;
+    int id = thief->th.th_topology_ids.ids[type];
+    if (id >= 0)
+      return id == victim->th.th_topology_ids.ids[type];
+  }
+  return true;
+}
+#endif
+
+// __kmp_pick_victim: pick a random thread other than tid to steal from,
+// preferring threads close to the calling thread so that stolen tasks tend to
+// run near their data. Up to __kmp_task_steal_near_tries draws are made before
+// settling for any victim; the default of one draw picks uniformly.
+static kmp_int32 __kmp_pick_victim(kmp_info_t *thread, kmp_int32 tid,
+                                   kmp_int32 nthreads,
+                                   kmp_thread_data_t *threads_data) {
+  kmp_int32 victim_tid = 0;
+  for (int i = 0; i < __kmp_task_steal_near_tries; ++i) {
+    victim_tid = __kmp_get_random(thread) % (nthreads - 1);
+    if (victim_tid >= tid) {
+      ++victim_tid; // Adjusts random distribution to exclude self
+    }
+#if KMP_AFFINITY_SUPPORTED
+    if (__kmp_is_near_victim(thread, threads_data[victim_tid].td.td_thr))
+      break;
+#else
+    break;
+#endif
+  }
+  return victim_tid;
+}
+
 // __kmp_steal_task: remove a task from another thread's deque
 // Assume that calling thread has already checked existence of
 // task_team thread_data before calling this routine.
@@ -3429,10 +3475,7 @@ static inline int __kmp_execute_tasks_template(
             // Pick a random thread. Initial plan was to cycle through all the
             // threads, and only return if we tried to steal from every thread,
             // and failed.  Arch says that's not such a great idea.
-            victim_tid = __kmp_get_random(thread) % (nthreads - 1);
-            if (victim_tid >= tid) {
-              ++victim_tid; // Adjusts random distribution to exclude self
-            }
+            victim_tid = __kmp_pick_victim(thread, tid, nthreads, threads_data);
             // Found a potential victim
             other_thread = threads_data[victim_tid].td.td_thr;
             // There is a slight chance that __kmp_enable_tasking() did not wake
@@ -77,6 +77,13 @@ class ScopBuilder final {
   // Build the SCoP for Region @p R.
   void buildScop(Region &R, AssumptionCache &AC);
 
+  /// Check whether the SCoP is larger than -polly-analysis-max-stmts or
+  /// -polly-analysis-max-accesses allow.
+  ///
+  /// This is cheap and is checked before any domains or access relations
+  /// have been built.
+  bool exceedsSizeBudget() const;
+
   /// Adjust the dimensions of @p Dom that was constructed for @p OldL
   ///        to be compatible to domains constructed for loop @p NewL.
   ///
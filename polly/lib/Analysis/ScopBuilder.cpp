@@ -67,6 +67,7 @@ STATISTIC(ScopFound, "Number of valid Scops");
 STATISTIC(RichScopFound, "Number of Scops containing a loop");
 STATISTIC(InfeasibleScops,
           "Number of SCoPs with statically infeasible context.");
+STATISTIC(TooLargeScops, "Number of SCoPs dismissed for their size");
 
 bool polly::ModelReadOnlyScalars;
 
@@ -88,6 +89,18 @@ static cl::opt<int>
                            "computational steps (0 means no bound)"),
                   cl::Hidden, cl::init(800000), cl::cat(PollyCategory));
 
+static cl::opt<unsigned> OptMaxStmts(
+    "polly-analysis-max-stmts",
+    cl::desc("Dismiss SCoPs with more statements than this before modeling "
+             "their domains (0 means no bound)"),
+    cl::Hidden, cl::init(0), cl::cat(PollyCategory));
+
+static cl::opt<unsigned> OptMaxAccesses(
+    "polly-analysis-max-accesses",
+    cl::desc("Dismiss SCoPs with more memory accesses than this before "
+             "modeling their domains (0 means no bound)"),
+    cl::Hidden, cl::init(0), cl::cat(PollyCategory));
+
 static cl::opt<bool> PollyAllowDereferenceOfAllFunctionParams(
     "polly-allow-dereference-of-all-function-parameters",
     cl::desc(
@@ -3497,6 +3510,25 @@ static void verifyUses(Scop *S, LoopInfo &LI, DominatorTree &DT) {
 }
 #endif
 
+bool ScopBuilder::exceedsSizeBudget() const {
+  if (OptMaxStmts && scop->getSize() > OptMaxStmts) {
+    POLLY_DEBUG(dbgs() << "Bailing-out because of too many statements\n");
+    return true;
+  }
+
+  if (OptMaxAccesses) {
+    size_t NumAccesses = 0;
+    for (ScopStmt &Stmt : *scop)
+      NumAccesses += Stmt.size();
+    if (NumAccesses > OptMaxAccesses) {
+      POLLY_DEBUG(dbgs() << "Bailing-out because of too many accesses\n");
+      return true;
+    }
+  }
+
+  return false;
+}
+
 void ScopBuilder::buildScop(Region &R, AssumptionCache &AC) {
   scop.reset(new Scop(R, SE, LI, DT, *SD.getDetectionContext(&R), ORE,
                       SD.getNextID()));
@@ -3558,6 +3590,15 @@ void ScopBuilder::buildScop(Region &R, AssumptionCache &AC) {
                      BP, BP->getType(), false, {AF}, {nullptr}, GlobalRead);
   }
 
+  // Everything from here on is modeled with isl, whose cost grows quickly
+  // with the size of the SCoP. Check the size budget first, since spending
+  // the computeout on a SCoP that is too large to optimize is wasted.
+  if (exceedsSizeBudget()) {
+    ++TooLargeScops;
+    scop->invalidate(COMPLEXITY, DebugLoc());
+    return;
+  }
+
   buildInvariantEquivalenceClasses();
 
   /// A map from basic blocks to their invalid domains.